@@ -0,0 +1,85 @@
+#include "GatherTextFromStringTableManifestsCommandlet.h"
+#include "StringTableGatherManifest.h"
+#include "LocTextHelper.h"
+#include "HAL/FileManager.h"
+
+int32 UGatherTextFromStringTableManifestsCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	const FString* ConfigPath = ParamsMap.Find(TEXT("Config"));
+	const FString* SectionName = ParamsMap.Find(TEXT("Section"));
+	if (ConfigPath == nullptr || SectionName == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("No config or section given, this commandlet runs as a step of the GatherText commandlet"));
+		return -1;
+	}
+
+	if (!GatherManifestHelper.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("No manifest to gather into, this commandlet runs as a step of the GatherText commandlet"));
+		return -1;
+	}
+
+	FString ManifestDirectory;
+	if (!GetPathFromConfig(**SectionName, TEXT("ManifestDirectory"), ManifestDirectory, *ConfigPath))
+	{
+		ManifestDirectory = FStringTableGatherManifests::GetManifestDirectory();
+	}
+
+	TArray<FString> ManifestFiles;
+	IFileManager::Get().FindFilesRecursive(ManifestFiles, *ManifestDirectory, TEXT("*.json"), true, false);
+
+	int32 GatheredCount = 0;
+	int32 GatheredTextCount = 0;
+	for (const FString& ManifestFile : ManifestFiles)
+	{
+		FStringTableGatherManifest Manifest;
+		if (!FStringTableGatherManifests::LoadManifest(ManifestFile, Manifest))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to read the string table gather manifest %s"), *ManifestFile);
+			continue;
+		}
+
+		//Several texts can share a key, the entry is gathered once with its first use as source location
+		TSet<FString> GatheredKeys;
+		for (const FStringTableGatherManifestEntry& Entry : Manifest.Entries)
+		{
+			bool bAlreadyGathered = false;
+			GatheredKeys.Add(Entry.Key, &bAlreadyGathered);
+			if (bAlreadyGathered)
+			{
+				continue;
+			}
+
+			FManifestContext Context;
+			Context.Key = Entry.Key;
+			Context.SourceLocation = FString::Printf(TEXT("%s - %s.%s"), *Entry.SourceAsset, *Entry.Row, *Entry.PropertyPath);
+
+			if (GatherManifestHelper->AddSourceText(Manifest.Namespace, FLocItem(Entry.SourceString), Context))
+			{
+				GatheredCount++;
+			}
+		}
+
+		//The other texts of the assets keep their own namespace and key, as the asset gather would have found them
+		for (const FStringTableGatherManifestText& Text : Manifest.Texts)
+		{
+			FManifestContext Context;
+			Context.Key = Text.Key;
+			Context.SourceLocation = FString::Printf(TEXT("%s - %s.%s"), *Text.SourceAsset, *Text.Row, *Text.PropertyPath);
+
+			if (GatherManifestHelper->AddSourceText(Text.Namespace, FLocItem(Text.SourceString), Context))
+			{
+				GatheredTextCount++;
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Gathered %d string table entries and %d other texts from %d manifests in %s"), GatheredCount, GatheredTextCount, ManifestFiles.Num(), *ManifestDirectory);
+
+	return 0;
+}
@@ -1,4 +1,5 @@
 #include "SStringTableGeneratorSettings.h"
+#include "StringTableGenerationProfile.h"
 #include "PropertyEditorModule.h"
 #include "Widgets/Layout/SUniformGridPanel.h"
 #include "ISinglePropertyView.h"
@@ -12,10 +13,28 @@ void SStringTableGeneratorSettings::Construct(const FArguments& InArgs)
 	Settings = NewObject<UStringTableGenerationSettings>();
 	Settings->SourceDataTable = InArgs._SourceDataTable;
 
-	//Get the names of all the properties that are a text
+	//Start from the profile used by the last generation
+	FString LastProfilePath;
+	if (GConfig->GetString(TEXT("StringTableGenerator"), TEXT("LastProfile"), LastProfilePath, GEditorPerProjectIni) && !LastProfilePath.IsEmpty())
+	{
+		if (UStringTableGenerationProfile* LastProfile = TSoftObjectPtr<UStringTableGenerationProfile>(FSoftObjectPath(LastProfilePath)).LoadSynchronous())
+		{
+			LastProfile->ApplyTo(Settings);
+		}
+	}
+
+	//Get the names of all the properties that are a text, the profile may already know them
 	const UScriptStruct* DTStruct = InArgs._SourceDataTable->GetRowStruct();
+	const TArray<FString>* ResolvedTextProperties = Settings->Profile ? Settings->Profile->FindResolvedTextPropertyPaths(DTStruct) : nullptr;
 	TArray<FString> TextProperties;
-	GetAllTextPropertiesRecursive(DTStruct, "", TextProperties);
+	if (ResolvedTextProperties != nullptr)
+	{
+		TextProperties = *ResolvedTextProperties;
+	}
+	else
+	{
+		UStringTableGenerator::GetAllTextPropertiesRecursive(DTStruct, "", TextProperties);
+	}
 
 	for (FString Text : TextProperties)
 	{
@@ -35,13 +54,12 @@ void SStringTableGeneratorSettings::Construct(const FArguments& InArgs)
 		];
 
 	//Set selected property name
-	if (PropertyNames.Num() > 0)
-	{
-		PropertyNameComboBox->SetSelectedItem(PropertyNames[0]);
-	}
+	SelectPropertyName(Settings->PropertyName);
 
 	//Create property views
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+	TSharedPtr<ISinglePropertyView> ProfileView = PropertyModule.CreateSingleProperty(Settings, TEXT("Profile"), FSinglePropertyParams());
+	TSharedPtr<ISinglePropertyView> StringTableFolderView = PropertyModule.CreateSingleProperty(Settings, TEXT("StringTableFolder"), FSinglePropertyParams());
 	TSharedPtr<ISinglePropertyView> SaveAllPropertiesView = PropertyModule.CreateSingleProperty(Settings, TEXT("bSaveAllProperties"), FSinglePropertyParams());
 	TSharedPtr<ISinglePropertyView> NewStringTableNameView = PropertyModule.CreateSingleProperty(Settings, TEXT("NewStringTableName"), FSinglePropertyParams());
 	TSharedPtr<ISinglePropertyView> CreateNewStringTableView = PropertyModule.CreateSingleProperty(Settings, TEXT("bCreateNewStringTable"), FSinglePropertyParams());
@@ -49,6 +67,12 @@ void SStringTableGeneratorSettings::Construct(const FArguments& InArgs)
 	TSharedPtr<ISinglePropertyView> StringIdPrefixView = PropertyModule.CreateSingleProperty(Settings, TEXT("StringIdPrefix"), FSinglePropertyParams());
 	TSharedPtr<ISinglePropertyView> StringIdSuffixView = PropertyModule.CreateSingleProperty(Settings, TEXT("StringIdSuffix"), FSinglePropertyParams());
 	TSharedPtr<ISinglePropertyView> IncludeLocalizedTextsView = PropertyModule.CreateSingleProperty(Settings, TEXT("bCopyAlreadyLocalizedKeys"), FSinglePropertyParams());
+	TSharedPtr<ISinglePropertyView> DedupNormalizedTextsView = PropertyModule.CreateSingleProperty(Settings, TEXT("bDedupNormalizedTexts"), FSinglePropertyParams());
+	TSharedPtr<ISinglePropertyView> SaveModifiedPackagesView = PropertyModule.CreateSingleProperty(Settings, TEXT("bSaveModifiedPackages"), FSinglePropertyParams());
+	TSharedPtr<ISinglePropertyView> BakeLookupTableView = PropertyModule.CreateSingleProperty(Settings, TEXT("bBakeLookupTable"), FSinglePropertyParams());
+	TSharedPtr<ISinglePropertyView> WriteGatherManifestView = PropertyModule.CreateSingleProperty(Settings, TEXT("bWriteGatherManifest"), FSinglePropertyParams());
+
+	ProfileView->SetOnPropertyValueChanged(FSimpleDelegate::CreateSP(this, &SStringTableGeneratorSettings::OnProfileChanged));
 
 	//Create buttons Generate and Cancel
 	TSharedPtr<SUniformGridPanel> ButtonsGrid = SNew(SUniformGridPanel)
@@ -84,6 +108,14 @@ void SStringTableGeneratorSettings::Construct(const FArguments& InArgs)
 		.HAlign(HAlign_Fill)
 		[
 			SNew(SVerticalBox)
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			.Padding(0.0, 0.0, 0.0, 5.0)
+			[
+				ProfileView.ToSharedRef()
+			]
+
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			.HAlign(HAlign_Fill)
@@ -92,6 +124,21 @@ void SStringTableGeneratorSettings::Construct(const FArguments& InArgs)
 				CreateNewStringTableView.ToSharedRef()
 			]
 
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			.Padding(0.0, 0.0, 0.0, 5.0)
+			[
+				SNew(SBorder)
+				.VAlign(VAlign_Fill)
+				.HAlign(HAlign_Fill)
+				.BorderImage(FAppStyle::GetBrush("NoBorder"))
+				.Visibility(this, &SStringTableGeneratorSettings::ShowCreateNewStringTable)
+				[
+					StringTableFolderView.ToSharedRef()
+				]
+			]
+
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			.HAlign(HAlign_Fill)
@@ -166,6 +213,38 @@ void SStringTableGeneratorSettings::Construct(const FArguments& InArgs)
 				IncludeLocalizedTextsView.ToSharedRef()
 			]
 
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			.Padding(0.0, 0.0, 0.0, 5.0)
+			[
+				DedupNormalizedTextsView.ToSharedRef()
+			]
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			.Padding(0.0, 0.0, 0.0, 5.0)
+			[
+				SaveModifiedPackagesView.ToSharedRef()
+			]
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			.Padding(0.0, 0.0, 0.0, 5.0)
+			[
+				BakeLookupTableView.ToSharedRef()
+			]
+
+			+ SVerticalBox::Slot()
+			.AutoHeight()
+			.HAlign(HAlign_Fill)
+			.Padding(0.0, 0.0, 0.0, 5.0)
+			[
+				WriteGatherManifestView.ToSharedRef()
+			]
+
 			+ SVerticalBox::Slot()
 			.AutoHeight()
 			.HAlign(HAlign_Fill)
@@ -200,6 +279,9 @@ FReply SStringTableGeneratorSettings::OnGenerateButtonClicked()
 		return FReply::Handled();
 	}
 
+	//Remember the profile for the next generation
+	GConfig->SetString(TEXT("StringTableGenerator"), TEXT("LastProfile"), Settings->Profile ? *Settings->Profile->GetPathName() : TEXT(""), GEditorPerProjectIni);
+
 	UStringTableGenerator::GenerateStringTableContent(Settings);
 
 	ParentWindow->RequestDestroyWindow();
@@ -212,6 +294,33 @@ FReply SStringTableGeneratorSettings::OnCancelButtonClicked()
 	return FReply::Handled();
 }
 
+void SStringTableGeneratorSettings::OnProfileChanged()
+{
+	if (Settings->Profile == nullptr)
+	{
+		return;
+	}
+
+	Settings->Profile->ApplyTo(Settings);
+	SelectPropertyName(Settings->PropertyName);
+}
+
+void SStringTableGeneratorSettings::SelectPropertyName(const FString& InPropertyName)
+{
+	if (PropertyNames.Num() == 0)
+	{
+		return;
+	}
+
+	//Fallback on the first property when the name isn't a text property of this DataTable
+	const TSharedPtr<FString>* FoundName = PropertyNames.FindByPredicate([&InPropertyName](const TSharedPtr<FString>& Name)
+	{
+		return *Name == InPropertyName;
+	});
+
+	PropertyNameComboBox->SetSelectedItem(FoundName ? *FoundName : PropertyNames[0]);
+}
+
 void SStringTableGeneratorSettings::OnPropertyNameSelectionChanged(TSharedPtr<FString> SelectedName, ESelectInfo::Type SelectionType)
 {
 	Settings->PropertyName = *SelectedName;
@@ -247,41 +356,3 @@ FText SStringTableGeneratorSettings::GetPropertyNameComboBoxContent() const
 
 	return FText();
 }
-
-void SStringTableGeneratorSettings::GetAllTextPropertiesRecursive(const UScriptStruct* Struct, FString ChainString, TArray<FString>& OutTextProperties) const
-{
-	FString DotChar = ChainString.IsEmpty() ? "" : ".";
-	// Iterate all properties of the struct
-	for (TFieldIterator<FProperty> It(Struct); It; ++It)
-	{
-		FProperty* Property = *It;
-		FString CurrentString = ChainString + DotChar + Property->GetName();
-
-		// If this property is a text property, add it to the output array
-		if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
-		{
-			OutTextProperties.Add(CurrentString);
-		}
-		// If this property is a struct property, recursively search in it
-		else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
-		{
-			GetAllTextPropertiesRecursive(StructProperty->Struct, CurrentString, OutTextProperties);
-		}
-		else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
-		{
-			FProperty* InnerProperty = ArrayProperty->Inner;
-
-			// If this property is a text property, add it to the output array
-			if (FTextProperty* ArrayTextProperty = CastField<FTextProperty>(InnerProperty))
-			{
-				OutTextProperties.Add(CurrentString);
-			}
-			// If this property is a struct property, recursively search in it
-			else if (FStructProperty* ArrayStructProperty = CastField<FStructProperty>(InnerProperty))
-			{
-				GetAllTextPropertiesRecursive(ArrayStructProperty->Struct, CurrentString, OutTextProperties);
-			}
-		}
-	}
-
-}
@@ -0,0 +1,445 @@
+#include "StringTableEquivalenceCommandlet.h"
+#include "StringTableGenerator.h"
+#include "StringTableGenerationProfile.h"
+#include "StringTableReferenceGenerator.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "UObject/GCObjectScopeGuard.h"
+
+/** Differences logged for each DataTable, the others are only counted **/
+static constexpr int32 MaxReportedDifferences = 20;
+
+UStringTableEquivalenceCommandlet::UStringTableEquivalenceCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UStringTableEquivalenceCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	//Fill the settings from the profile first then from the command line, like the StringTableGenerator commandlet
+	UStringTableGenerationSettings* Settings = NewObject<UStringTableGenerationSettings>();
+	FGCObjectScopeGuard SettingsGuard(Settings);
+
+	if (const FString* ProfilePath = ParamsMap.Find(TEXT("Profile")))
+	{
+		UStringTableGenerationProfile* Profile = LoadObject<UStringTableGenerationProfile>(nullptr, **ProfilePath);
+		if (Profile == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load the generation profile %s"), **ProfilePath);
+			return 1;
+		}
+
+		Profile->ApplyTo(Settings);
+	}
+	else
+	{
+		Settings->bSaveAllProperties = true;
+	}
+
+	if (const FString* PropertyName = ParamsMap.Find(TEXT("Property")))
+	{
+		Settings->bSaveAllProperties = false;
+		Settings->PropertyName = *PropertyName;
+	}
+
+	if (const FString* Prefix = ParamsMap.Find(TEXT("Prefix")))
+	{
+		Settings->StringIdPrefix = *Prefix;
+	}
+
+	if (const FString* Suffix = ParamsMap.Find(TEXT("Suffix")))
+	{
+		Settings->StringIdSuffix = *Suffix;
+	}
+
+	Settings->bCopyAlreadyLocalizedKeys |= Switches.Contains(TEXT("CopyLocalizedKeys"));
+	Settings->bDedupNormalizedTexts |= Switches.Contains(TEXT("DedupNormalizedTexts"));
+
+	//Both generations start from the content of this table, they never write into it
+	UStringTable* InitialStringTable = Settings->bCreateNewStringTable ? nullptr : Settings->ExistingStringTable.Get();
+	if (const FString* StringTablePath = ParamsMap.Find(TEXT("StringTable")))
+	{
+		InitialStringTable = LoadObject<UStringTable>(nullptr, **StringTablePath);
+		if (InitialStringTable == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load the string table %s"), **StringTablePath);
+			return 1;
+		}
+	}
+	FGCObjectScopeGuard InitialStringTableGuard(InitialStringTable);
+
+	const FString* IterationsParam = ParamsMap.Find(TEXT("Iterations"));
+	const int32 Iterations = IterationsParam ? FMath::Max(1, FCString::Atoi(**IterationsParam)) : 1;
+
+	int32 DifferenceCount = 0;
+	int32 CheckedCount = 0;
+
+	TArray<FString> DataTablePaths;
+	ParamsMap.FindRef(TEXT("DataTables")).ParseIntoArray(DataTablePaths, TEXT("+"));
+	for (const FString& DataTablePath : DataTablePaths)
+	{
+		UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *DataTablePath);
+		if (DataTable == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load the DataTable %s"), *DataTablePath);
+			return 1;
+		}
+
+		DifferenceCount += CheckEquivalence(DataTable, Settings, InitialStringTable, Iterations);
+		CheckedCount++;
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	const FString* RandomTablesParam = ParamsMap.Find(TEXT("RandomTables"));
+	const int32 RandomTableCount = RandomTablesParam ? FCString::Atoi(**RandomTablesParam) : (DataTablePaths.IsEmpty() ? 1 : 0);
+
+	const FString* RandomRowsParam = ParamsMap.Find(TEXT("RandomRows"));
+	const int32 RandomRowCount = RandomRowsParam ? FMath::Max(1, FCString::Atoi(**RandomRowsParam)) : 1000;
+
+	int32 Seed = 0;
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+
+	for (int32 TableIndex = 0; TableIndex < RandomTableCount; ++TableIndex)
+	{
+		//The randomized rows use their own struct, the selected property of the settings may not exist in it
+		const FString SelectedPropertyName = Settings->PropertyName;
+		const bool bSaveAllProperties = Settings->bSaveAllProperties;
+		if (FStringTableEquivalenceRow::StaticStruct()->FindPropertyByName(FName(SelectedPropertyName)) == nullptr)
+		{
+			Settings->bSaveAllProperties = true;
+			Settings->PropertyName.Reset();
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Random DataTable %d, seed %d"), TableIndex, Seed + TableIndex);
+		DifferenceCount += CheckEquivalence(CreateRandomDataTable(RandomRowCount, Seed + TableIndex), Settings, InitialStringTable, Iterations);
+		CheckedCount++;
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		Settings->PropertyName = SelectedPropertyName;
+		Settings->bSaveAllProperties = bSaveAllProperties;
+	}
+
+	if (CheckedCount == 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Nothing to check, use -DataTables=/Game/MyDataTable.MyDataTable or -RandomTables=1"));
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("%d DataTables checked, %d differences with the reference generation."), CheckedCount, DifferenceCount);
+	return DifferenceCount > 0 ? 1 : 0;
+}
+
+int32 UStringTableEquivalenceCommandlet::CheckEquivalence(UDataTable* DataTable, UStringTableGenerationSettings* Settings, UStringTable* InitialStringTable, int32 Iterations)
+{
+	ReportedDifferenceCount = 0;
+
+	//The copied entries are indexed by the normalized dedup since the reference was frozen, see FStringTableReferenceGenerator
+	bDifferencesExpected = Settings->bCopyAlreadyLocalizedKeys && Settings->bDedupNormalizedTexts;
+
+	TArray<FString> PropertyPaths;
+	UStringTableGenerator::GetAllTextPropertiesRecursive(DataTable->GetRowStruct(), "", PropertyPaths);
+	if (PropertyPaths.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s has no text property, skipped"), *DataTable->GetPathName());
+		return 0;
+	}
+
+	//Same defaults as the settings window, the reference names the new keys after the selected property only
+	const FString SelectedPropertyName = Settings->PropertyName;
+	Settings->AllPropertyNames = PropertyPaths;
+	if (Settings->PropertyName.IsEmpty())
+	{
+		Settings->PropertyName = PropertyPaths[0];
+	}
+
+	//Run a generation on fresh copies of the DataTable and of the string table, only the generation itself is timed
+	auto RunGeneration = [&](bool bReference, UDataTable*& OutDataTable, UStringTable*& OutStringTable)
+	{
+		const TCHAR* ModeName = bReference ? TEXT("Reference") : TEXT("Optimized");
+		double Seconds = 0.0;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			UPackage* TransientPackage = GetTransientPackage();
+			OutDataTable = DuplicateObject<UDataTable>(DataTable, TransientPackage, MakeUniqueObjectName(TransientPackage, UDataTable::StaticClass(), *FString::Printf(TEXT("%s_%s"), *DataTable->GetName(), ModeName)));
+			OutStringTable = NewObject<UStringTable>(TransientPackage, MakeUniqueObjectName(TransientPackage, UStringTable::StaticClass(), *FString::Printf(TEXT("ST_%s"), ModeName)));
+
+			if (InitialStringTable != nullptr)
+			{
+				FStringTableConstRef SrcStringTable = InitialStringTable->GetStringTable();
+				FStringTableRef DstStringTable = OutStringTable->GetMutableStringTable();
+				DstStringTable->SetNamespace(SrcStringTable->GetNamespace());
+				SrcStringTable->EnumerateSourceStrings([&](const FString& InKey, const FString& InSourceString)
+				{
+					DstStringTable->SetSourceString(InKey, InSourceString);
+					SrcStringTable->EnumerateMetaData(InKey, [&](FName MetaDataId, const FString& MetaData)
+					{
+						DstStringTable->SetMetaData(InKey, MetaDataId, MetaData);
+						return true; // continue enumeration
+					});
+					return true; // continue enumeration
+				});
+			}
+
+			Settings->SourceDataTable = OutDataTable;
+
+			const double StartTime = FPlatformTime::Seconds();
+			if (bReference)
+			{
+				FStringTableReferenceGenerator::GenerateStringTableEntries(OutStringTable, Settings);
+			}
+			else
+			{
+				UStringTableGenerator::GenerateStringTableEntries(OutStringTable, Settings);
+			}
+			Seconds += FPlatformTime::Seconds() - StartTime;
+		}
+
+		Settings->SourceDataTable = nullptr;
+		return Seconds / Iterations;
+	};
+
+	UDataTable* ReferenceDataTable = nullptr;
+	UStringTable* ReferenceTable = nullptr;
+	const double ReferenceSeconds = RunGeneration(true, ReferenceDataTable, ReferenceTable);
+
+	UDataTable* OptimizedDataTable = nullptr;
+	UStringTable* OptimizedTable = nullptr;
+	const double OptimizedSeconds = RunGeneration(false, OptimizedDataTable, OptimizedTable);
+
+	Settings->PropertyName = SelectedPropertyName;
+
+	int32 DifferenceCount = DiffStringTables(ReferenceTable, OptimizedTable);
+	DifferenceCount += DiffLinkedTexts(ReferenceDataTable, ReferenceTable, OptimizedDataTable, OptimizedTable, PropertyPaths);
+
+	int32 EntryCount = 0;
+	OptimizedTable->GetStringTable()->EnumerateSourceStrings([&EntryCount](const FString&, const FString&)
+	{
+		EntryCount++;
+		return true; // continue enumeration
+	});
+
+	UE_LOG(LogTemp, Display, TEXT("%s: %d rows, %d entries, %d iterations"), *DataTable->GetPathName(), DataTable->GetRowMap().Num(), EntryCount, Iterations);
+	UE_LOG(LogTemp, Display, TEXT("  Reference: %.3f ms per generation"), ReferenceSeconds * 1000.0);
+	UE_LOG(LogTemp, Display, TEXT("  Optimized: %.3f ms per generation (%.2fx)"), OptimizedSeconds * 1000.0, OptimizedSeconds > 0.0 ? ReferenceSeconds / OptimizedSeconds : 0.0);
+
+	if (DifferenceCount > 0 && bDifferencesExpected)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  %d differences with the reference generation, expected since copied entries are indexed by the normalized dedup"), DifferenceCount);
+		return 0;
+	}
+	else if (DifferenceCount > 0)
+	{
+		UE_LOG(LogTemp, Error, TEXT("  %d differences with the reference generation"), DifferenceCount);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Display, TEXT("  Same entries and links as the reference generation"));
+	}
+
+	return DifferenceCount;
+}
+
+int32 UStringTableEquivalenceCommandlet::DiffStringTables(UStringTable* ReferenceTable, UStringTable* OptimizedTable)
+{
+	FStringTableConstRef Reference = ReferenceTable->GetStringTable();
+	FStringTableConstRef Optimized = OptimizedTable->GetStringTable();
+
+	//Gather the meta-data of an entry to compare it as a whole
+	auto GetMetaData = [](FStringTableConstRef Table, const FString& Key)
+	{
+		TMap<FName, FString> MetaDataMap;
+		Table->EnumerateMetaData(Key, [&MetaDataMap](FName MetaDataId, const FString& MetaData)
+		{
+			MetaDataMap.Add(MetaDataId, MetaData);
+			return true; // continue enumeration
+		});
+		return MetaDataMap;
+	};
+
+	int32 DifferenceCount = 0;
+	Reference->EnumerateSourceStrings([&](const FString& InKey, const FString& InSourceString)
+	{
+		FString OptimizedSourceString;
+		if (!Optimized->GetSourceString(InKey, OptimizedSourceString))
+		{
+			ReportDifference(FString::Printf(TEXT("Entry %s is missing, reference source string \"%s\""), *InKey, *InSourceString));
+			DifferenceCount++;
+		}
+		else if (!OptimizedSourceString.Equals(InSourceString, ESearchCase::CaseSensitive))
+		{
+			ReportDifference(FString::Printf(TEXT("Entry %s has the source string \"%s\" instead of \"%s\""), *InKey, *OptimizedSourceString, *InSourceString));
+			DifferenceCount++;
+		}
+		else if (!GetMetaData(Reference, InKey).OrderIndependentCompareEqual(GetMetaData(Optimized, InKey)))
+		{
+			ReportDifference(FString::Printf(TEXT("Entry %s has different meta-data"), *InKey));
+			DifferenceCount++;
+		}
+		return true; // continue enumeration
+	});
+
+	Optimized->EnumerateSourceStrings([&](const FString& InKey, const FString& InSourceString)
+	{
+		FString ReferenceSourceString;
+		if (!Reference->GetSourceString(InKey, ReferenceSourceString))
+		{
+			ReportDifference(FString::Printf(TEXT("Entry %s is not in the reference, source string \"%s\""), *InKey, *InSourceString));
+			DifferenceCount++;
+		}
+		return true; // continue enumeration
+	});
+
+	return DifferenceCount;
+}
+
+int32 UStringTableEquivalenceCommandlet::DiffLinkedTexts(UDataTable* ReferenceDataTable, UStringTable* ReferenceTable, UDataTable* OptimizedDataTable, UStringTable* OptimizedTable, const TArray<FString>& PropertyPaths)
+{
+	//Describe a text by its link, the tables of both generations have different ids so a link to its own table is described without the id
+	auto DescribeText = [](const FText& Text, UStringTable* OwnTable)
+	{
+		FName TableId;
+		FString Key;
+		if (FTextInspector::GetTableIdAndKey(Text, TableId, Key))
+		{
+			return TableId == OwnTable->GetStringTableId() ? FString::Printf(TEXT("key %s"), *Key) : FString::Printf(TEXT("key %s of %s"), *Key, *TableId.ToString());
+		}
+		return FString::Printf(TEXT("unlinked \"%s\""), *Text.ToString());
+	};
+
+	const UScriptStruct* RowStruct = ReferenceDataTable->GetRowStruct();
+
+	int32 DifferenceCount = 0;
+	for (const FName& RowName : ReferenceDataTable->GetRowNames())
+	{
+		uint8* ReferenceRow = ReferenceDataTable->FindRowUnchecked(RowName);
+		uint8* OptimizedRow = OptimizedDataTable->FindRowUnchecked(RowName);
+		if (ReferenceRow == nullptr || OptimizedRow == nullptr)
+		{
+			continue;
+		}
+
+		TArray<FText*> ReferenceTexts;
+		TArray<FText*> OptimizedTexts;
+		//Listed with the reflection of the reference, the compiled visitors of the optimized generation are part of what is checked
+		FStringTableReferenceGenerator::GetTexts(ReferenceRow, RowStruct, PropertyPaths, ReferenceTexts);
+		FStringTableReferenceGenerator::GetTexts(OptimizedRow, RowStruct, PropertyPaths, OptimizedTexts);
+
+		if (ReferenceTexts.Num() != OptimizedTexts.Num())
+		{
+			ReportDifference(FString::Printf(TEXT("Row %s has %d texts instead of %d"), *RowName.ToString(), OptimizedTexts.Num(), ReferenceTexts.Num()));
+			DifferenceCount++;
+			continue;
+		}
+
+		for (int32 TextIndex = 0; TextIndex < ReferenceTexts.Num(); ++TextIndex)
+		{
+			const FString ReferenceText = DescribeText(*ReferenceTexts[TextIndex], ReferenceTable);
+			const FString OptimizedText = DescribeText(*OptimizedTexts[TextIndex], OptimizedTable);
+			if (!OptimizedText.Equals(ReferenceText, ESearchCase::CaseSensitive))
+			{
+				ReportDifference(FString::Printf(TEXT("Row %s text %d is linked to %s instead of %s"), *RowName.ToString(), TextIndex, *OptimizedText, *ReferenceText));
+				DifferenceCount++;
+			}
+		}
+	}
+
+	return DifferenceCount;
+}
+
+UDataTable* UStringTableEquivalenceCommandlet::CreateRandomDataTable(int32 RowCount, int32 Seed)
+{
+	FRandomStream Random(Seed);
+
+	//A small vocabulary so the same strings come back often, with the variants the normalized dedup merges
+	//All the texts of a row share the same key name, so most rows also go through the key collision probing
+	static const TCHAR* Words[] = { TEXT("Sword"), TEXT("Shield"), TEXT("Potion"), TEXT("of"), TEXT("the"), TEXT("Ancient"), TEXT("Broken"), TEXT("Fire"), TEXT("Ice"), TEXT("Restores health."), TEXT("Deals damage."), TEXT("Cannot be sold.") };
+	auto RandomText = [&Random]()
+	{
+		const int32 Roll = Random.RandRange(0, 99);
+		if (Roll < 10)
+		{
+			return FText::GetEmpty();
+		}
+
+		FString String;
+		const int32 WordCount = Random.RandRange(1, 4);
+		for (int32 i = 0; i < WordCount; ++i)
+		{
+			if (i > 0)
+			{
+				String += Roll < 20 ? TEXT("\r\n") : (Roll < 25 ? TEXT("\n") : TEXT(" "));
+			}
+			String += Words[Random.RandRange(0, (int32)UE_ARRAY_COUNT(Words) - 1)];
+		}
+
+		if (Roll >= 90)
+		{
+			String += TEXT(" ");
+		}
+
+		return FText::FromString(String);
+	};
+
+	UPackage* TransientPackage = GetTransientPackage();
+	UDataTable* DataTable = NewObject<UDataTable>(TransientPackage, MakeUniqueObjectName(TransientPackage, UDataTable::StaticClass(), TEXT("DT_Random")));
+	DataTable->RowStruct = FStringTableEquivalenceRow::StaticStruct();
+
+	for (int32 RowIndex = 0; RowIndex < RowCount; ++RowIndex)
+	{
+		FStringTableEquivalenceRow Row;
+		Row.Name = RandomText();
+		Row.Description = RandomText();
+
+		const int32 LineCount = Random.RandRange(0, 3);
+		for (int32 i = 0; i < LineCount; ++i)
+		{
+			Row.Lines.Add(RandomText());
+		}
+
+		const int32 ChoiceCount = Random.RandRange(0, 2);
+		for (int32 i = 0; i < ChoiceCount; ++i)
+		{
+			FStringTableEquivalenceChoice& Choice = Row.Choices.AddDefaulted_GetRef();
+			Choice.Label = RandomText();
+			Choice.Tooltip = RandomText();
+		}
+
+		if (Random.RandRange(0, 3) == 0)
+		{
+			Row.Tags.Add(TEXT("Rarity"), RandomText());
+		}
+
+		DataTable->AddRow(FName(*FString::Printf(TEXT("Item_%d"), RowIndex)), Row);
+	}
+
+	return DataTable;
+}
+
+void UStringTableEquivalenceCommandlet::ReportDifference(const FString& Message)
+{
+	if (ReportedDifferenceCount < MaxReportedDifferences)
+	{
+		if (bDifferencesExpected)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("  %s"), *Message);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("  %s"), *Message);
+		}
+	}
+	else if (ReportedDifferenceCount == MaxReportedDifferences)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  ..."));
+	}
+
+	ReportedDifferenceCount++;
+}
@@ -0,0 +1,117 @@
+#include "StringTableGatherManifest.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "JsonObjectConverter.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "ISourceControlModule.h"
+#include "SourceControlHelpers.h"
+
+/** Order the records of a manifest by asset, row and property path so the file only changes with its content **/
+template<typename RecordType>
+static void SortManifestRecords(TArray<RecordType>& Records)
+{
+	Records.StableSort([](const RecordType& A, const RecordType& B)
+	{
+		if (A.SourceAsset != B.SourceAsset)
+		{
+			return A.SourceAsset < B.SourceAsset;
+		}
+		if (A.Row != B.Row)
+		{
+			return A.Row < B.Row;
+		}
+		return A.PropertyPath < B.PropertyPath;
+	});
+}
+
+FString FStringTableGatherManifests::GetManifestDirectory()
+{
+	return FPaths::ProjectConfigDir() / TEXT("StringTableGenerator") / TEXT("GatherManifests");
+}
+
+FString FStringTableGatherManifests::GetManifestFilePath(const UStringTable* StringTable)
+{
+	//Mirror the content folders so string tables with the same name don't share a manifest
+	FString PackageName = StringTable->GetPackage()->GetName();
+	PackageName.RemoveFromStart(TEXT("/"));
+	return GetManifestDirectory() / PackageName + TEXT(".json");
+}
+
+bool FStringTableGatherManifests::LoadManifest(const FString& Filename, FStringTableGatherManifest& OutManifest)
+{
+	FString Json;
+	return FFileHelper::LoadFileToString(Json, *Filename) && FJsonObjectConverter::JsonObjectStringToUStruct(Json, &OutManifest);
+}
+
+bool FStringTableGatherManifests::UpdateManifest(const UStringTable* StringTable, const TSet<FString>& ProcessedAssets, TArray<FStringTableGatherManifestEntry>&& NewEntries, TArray<FStringTableGatherManifestText>&& NewTexts)
+{
+	const FString Filename = GetManifestFilePath(StringTable);
+	FStringTableGatherManifest Manifest;
+	LoadManifest(Filename, Manifest);
+
+	Manifest.StringTable = StringTable->GetPathName();
+	Manifest.TableId = StringTable->GetStringTableId().ToString();
+	Manifest.Namespace = StringTable->GetStringTable()->GetNamespace();
+
+	//Keep the entries and texts of the assets generated by other runs
+	Manifest.Entries.RemoveAll([&ProcessedAssets](const FStringTableGatherManifestEntry& Entry)
+	{
+		return ProcessedAssets.Contains(Entry.SourceAsset);
+	});
+	Manifest.Entries.Append(MoveTemp(NewEntries));
+
+	Manifest.Texts.RemoveAll([&ProcessedAssets](const FStringTableGatherManifestText& Text)
+	{
+		return ProcessedAssets.Contains(Text.SourceAsset);
+	});
+	Manifest.Texts.Append(MoveTemp(NewTexts));
+
+	//Take the source strings from the string table, it may have been edited since the other runs
+	FStringTableConstRef Table = StringTable->GetStringTable();
+	Manifest.Entries.RemoveAll([&Table](FStringTableGatherManifestEntry& Entry)
+	{
+		return !Table->GetSourceString(Entry.Key, Entry.SourceString);
+	});
+
+	SortManifestRecords(Manifest.Entries);
+	SortManifestRecords(Manifest.Texts);
+
+	FString Json;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Manifest, Json, 0, 0, 0, nullptr, false))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write the gather manifest of %s"), *Manifest.StringTable);
+		return false;
+	}
+
+	//The manifests are shared through source control, check the file out before writing it and add it once it exists
+	const bool bSourceControlEnabled = ISourceControlModule::Get().IsEnabled();
+	const bool bNewFile = !FPaths::FileExists(Filename);
+	if (!bNewFile)
+	{
+		if (bSourceControlEnabled)
+		{
+			USourceControlHelpers::CheckOutFile(Filename, true);
+		}
+
+		if (IFileManager::Get().IsReadOnly(*Filename))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s is read-only, making it writable"), *Filename);
+			FPlatformFileManager::Get().GetPlatformFile().SetReadOnly(*Filename, false);
+		}
+	}
+
+	if (!FFileHelper::SaveStringToFile(Json, *Filename, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+	{
+		return false;
+	}
+
+	if (bNewFile && bSourceControlEnabled)
+	{
+		USourceControlHelpers::MarkFileForAdd(Filename, true);
+	}
+
+	return true;
+}
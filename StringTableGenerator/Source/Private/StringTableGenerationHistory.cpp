@@ -0,0 +1,107 @@
+#include "StringTableGenerationHistory.h"
+#include "JsonObjectConverter.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+double FStringTableGenerationRecord::GetDedupHitRate() const
+{
+	const int32 LinkedTextCount = DedupHitCount + NewKeyCount;
+	return LinkedTextCount > 0 ? (double)DedupHitCount / LinkedTextCount : 0.0;
+}
+
+double FStringTableGenerationRecord::GetSecondsPerRow() const
+{
+	return RowCount > 0 ? GenerateSeconds / RowCount : 0.0;
+}
+
+FString FStringTableGenerationHistory::GetHistoryFilePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("StringTableGenerator") / TEXT("GenerationHistory.jsonl");
+}
+
+void FStringTableGenerationHistory::AppendRecord(const FStringTableGenerationRecord& Record)
+{
+	FString Line;
+	if (!FJsonObjectConverter::UStructToJsonObjectString(Record, Line, 0, 0, 0, nullptr, false))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write the string table generation record"));
+		return;
+	}
+
+	Line.AppendChar(TEXT('\n'));
+	FFileHelper::SaveStringToFile(Line, *GetHistoryFilePath(), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM, &IFileManager::Get(), FILEWRITE_Append);
+}
+
+void FStringTableGenerationHistory::LoadRecords(TArray<FStringTableGenerationRecord>& OutRecords)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *GetHistoryFilePath()))
+	{
+		return;
+	}
+
+	for (const FString& Line : Lines)
+	{
+		FStringTableGenerationRecord Record;
+		if (!Line.IsEmpty() && FJsonObjectConverter::JsonObjectStringToUStruct(Line, &Record))
+		{
+			OutRecords.Add(MoveTemp(Record));
+		}
+	}
+}
+
+TArray<int32> FStringTableGenerationHistory::ReportTrends(const TArray<FStringTableGenerationRecord>& Records, int32 BaselineRunCount, double SlowdownThreshold)
+{
+	TArray<int32> SlowRuns;
+
+	//Previous runs of each source, most recent last
+	TMap<FString, TArray<double>> PreviousSecondsPerRow;
+
+	UE_LOG(LogTemp, Display, TEXT("%-20s %-48s %8s %8s %8s %8s %8s %10s %10s %8s"), TEXT("Date"), TEXT("Source"), TEXT("Rows"), TEXT("Texts"), TEXT("Dedup%"), TEXT("NewKeys"), TEXT("Probes"), TEXT("Total(s)"), TEXT("us/row"), TEXT("+PeakMB"));
+	for (int32 i = 0; i < Records.Num(); ++i)
+	{
+		const FStringTableGenerationRecord& Record = Records[i];
+		const double SecondsPerRow = Record.GetSecondsPerRow();
+
+		//Compare to the average of the previous runs of the same source
+		TArray<double>& Previous = PreviousSecondsPerRow.FindOrAdd(Record.Source);
+		double Baseline = 0.0;
+		for (double PreviousSecondsPerRowValue : Previous)
+		{
+			Baseline += PreviousSecondsPerRowValue;
+		}
+		Baseline = Previous.IsEmpty() ? 0.0 : Baseline / Previous.Num();
+
+		const bool bIsSlow = Baseline > 0.0 && SecondsPerRow > Baseline * SlowdownThreshold;
+		if (bIsSlow)
+		{
+			SlowRuns.Add(i);
+		}
+
+		const FString Line = FString::Printf(TEXT("%-20s %-48s %8d %8d %7.1f%% %8d %8d %10.3f %10.1f %8lld"),
+			*Record.Date.Left(19), *Record.Source.Right(48), Record.RowCount, Record.TextCount, Record.GetDedupHitRate() * 100.0,
+			Record.NewKeyCount, Record.CollisionProbeCount, Record.TotalSeconds, SecondsPerRow * 1000000.0, Record.PeakUsedPhysicalDeltaBytes / (1024 * 1024));
+
+		if (bIsSlow)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s  <- %.1fx slower per row than the baseline"), *Line, SecondsPerRow / Baseline);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("%s"), *Line);
+		}
+
+		//Keep a rolling window of the last runs
+		if (Record.RowCount > 0)
+		{
+			Previous.Add(SecondsPerRow);
+			if (Previous.Num() > BaselineRunCount)
+			{
+				Previous.RemoveAt(0);
+			}
+		}
+	}
+
+	return SlowRuns;
+}
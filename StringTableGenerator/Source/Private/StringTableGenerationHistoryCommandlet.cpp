@@ -0,0 +1,32 @@
+#include "StringTableGenerationHistoryCommandlet.h"
+#include "StringTableGenerationHistory.h"
+
+UStringTableGenerationHistoryCommandlet::UStringTableGenerationHistoryCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UStringTableGenerationHistoryCommandlet::Main(const FString& Params)
+{
+	int32 BaselineRunCount = 10;
+	FParse::Value(*Params, TEXT("Baseline="), BaselineRunCount);
+
+	float SlowdownThreshold = 1.5f;
+	FParse::Value(*Params, TEXT("Threshold="), SlowdownThreshold);
+
+	TArray<FStringTableGenerationRecord> Records;
+	FStringTableGenerationHistory::LoadRecords(Records);
+	if (Records.IsEmpty())
+	{
+		UE_LOG(LogTemp, Display, TEXT("No string table generation found in %s"), *FStringTableGenerationHistory::GetHistoryFilePath());
+		return 0;
+	}
+
+	TArray<int32> SlowRuns = FStringTableGenerationHistory::ReportTrends(Records, FMath::Max(1, BaselineRunCount), SlowdownThreshold);
+	UE_LOG(LogTemp, Display, TEXT("%d runs, %d slower than their baseline."), Records.Num(), SlowRuns.Num());
+
+	return SlowRuns.Contains(Records.Num() - 1) ? 1 : 0;
+}
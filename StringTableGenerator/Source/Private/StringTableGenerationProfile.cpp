@@ -0,0 +1,61 @@
+#include "StringTableGenerationProfile.h"
+#include "StringTableGenerator.h"
+#include "Internationalization/StringTable.h"
+
+void UStringTableGenerationProfile::ApplyTo(UStringTableGenerationSettings* Settings) const
+{
+	Settings->Profile = const_cast<UStringTableGenerationProfile*>(this);
+	Settings->bSaveAllProperties = bSaveAllProperties;
+	Settings->PropertyName = PropertyName;
+	Settings->bCopyAlreadyLocalizedKeys = bCopyAlreadyLocalizedKeys;
+	Settings->bDedupNormalizedTexts = bDedupNormalizedTexts;
+	Settings->bCreateNewStringTable = bCreateNewStringTable;
+	Settings->StringTableFolder = StringTableFolder;
+	Settings->NewStringTableName = NewStringTableName;
+	Settings->StringIdPrefix = StringIdPrefix;
+	Settings->StringIdSuffix = StringIdSuffix;
+	Settings->bSaveModifiedPackages = bSaveModifiedPackages;
+	Settings->bBakeLookupTable = bBakeLookupTable;
+	Settings->bWriteGatherManifest = bWriteGatherManifest;
+	Settings->AssetBatchSize = AssetBatchSize;
+
+	//Reuse the table loaded by the previous run instead of loading it again
+	const bool bExistingStringTableResolved = ResolvedStringTable != nullptr && ExistingStringTable.ToSoftObjectPath() == FSoftObjectPath(ResolvedStringTable);
+	Settings->ExistingStringTable = bExistingStringTableResolved ? ResolvedStringTable.Get() : ExistingStringTable.LoadSynchronous();
+}
+
+UStringTable* UStringTableGenerationProfile::GetResolvedStringTable(const UStringTableGenerationSettings* Settings) const
+{
+	if (ResolvedStringTable == nullptr)
+	{
+		return nullptr;
+	}
+
+	//The settings of this run can override the table of the profile (settings window, -Folder, -NewStringTable...)
+	if (Settings->bCreateNewStringTable)
+	{
+		const FString PackageName = Settings->StringTableFolder / Settings->NewStringTableName;
+		return ResolvedStringTable->GetPackage()->GetName() == PackageName ? ResolvedStringTable.Get() : nullptr;
+	}
+
+	return Settings->ExistingStringTable == ResolvedStringTable ? ResolvedStringTable.Get() : nullptr;
+}
+
+void UStringTableGenerationProfile::SetResolvedStringTable(UStringTable* StringTable)
+{
+	ResolvedStringTable = StringTable;
+}
+
+const TArray<FString>* UStringTableGenerationProfile::FindResolvedTextPropertyPaths(const UStruct* Struct) const
+{
+	return ResolvedTextPropertyPaths.Find(FObjectKey(Struct));
+}
+
+void UStringTableGenerationProfile::SetResolvedTextPropertyPaths(const UStruct* Struct, const TArray<FString>& PropertyPaths)
+{
+	//User defined structs and blueprint classes can be recompiled with other properties, only native types are kept
+	if (Struct->GetPackage()->HasAnyPackageFlags(PKG_CompiledIn))
+	{
+		ResolvedTextPropertyPaths.Add(FObjectKey(Struct), PropertyPaths);
+	}
+}
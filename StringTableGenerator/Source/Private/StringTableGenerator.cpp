@@ -1,13 +1,33 @@
 #include "StringTableGenerator.h"
+#include "StringTableGenerationProfile.h"
+#include "StringTableGenerationHistory.h"
+#include "StringTableGatherManifest.h"
+#include "StringTableTextVisitorRegistry.h"
+#include "StringTableLookup.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "SStringTableGeneratorSettings.h"
 #include "AssetToolsModule.h"
 #include "Factories/StringTableFactory.h"
 #include "Internationalization/StringTable.h"
 #include "Internationalization/StringTableCore.h"
+#include "Internationalization/StringTableRegistry.h"
 #include "StringTableEditorModule.h"
 #include "Modules/ModuleManager.h"
 #include "Internationalization/Text.h"
+#include "UObject/PropertyOptional.h"
+#include "UObject/GCObjectScopeGuard.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Engine/DataTable.h"
+#include "UObject/SavePackage.h"
+#include "FileHelpers.h"
+#include "ISourceControlModule.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "HAL/PlatformMemory.h"
 
 void UStringTableGenerator::OpenSettingsPopup(UDataTable* DT)
 {
@@ -20,7 +40,7 @@ void UStringTableGenerator::OpenSettingsPopup(UDataTable* DT)
 	TSharedPtr<SWindow> Window = SNew(SWindow)
 		.Title(FText::FromString(TEXT("String Table Generation Settings")))
 		.SizingRule(ESizingRule::FixedSize)
-		.ClientSize(FVector2D(450.0, 300.0))
+		.ClientSize(FVector2D(450.0, 450.0))
 		.AutoCenter(EAutoCenter::PreferredWorkArea)
 		.SupportsMinimize(false)
 		.SupportsMaximize(false);
@@ -36,86 +56,722 @@ void UStringTableGenerator::OpenSettingsPopup(UDataTable* DT)
 	GEditor->EditorAddModalWindow(Window.ToSharedRef());
 }
 
-void UStringTableGenerator::GenerateStringTableContent(UStringTableGenerationSettings* Settings)
+/** State shared by all the rows and assets processed during a single generation **/
+struct FStringTableGenerationContext
 {
-	//Create or load string
-	UStringTable* StringTable;
-	if (Settings->bCreateNewStringTable)
+	FStringTableGenerationContext(UStringTable* InStringTable, UStringTableGenerationSettings* InSettings)
+		: StringTable(InStringTable)
+		, Settings(InSettings)
+		, StartUsedPhysical(FPlatformMemory::GetStats().UsedPhysical)
+		, bRecordManifest(InSettings->bWriteGatherManifest)
 	{
-		StringTable = CreateStringTable(Settings->NewStringTableName);
 	}
-	else
+
+	/** Update the peak memory of the generation with the memory currently used by the process **/
+	void SampleMemory()
 	{
-		StringTable = Settings->ExistingStringTable.Get();
+		const int64 UsedPhysicalDelta = (int64)FPlatformMemory::GetStats().UsedPhysical - (int64)StartUsedPhysical;
+		Record.PeakUsedPhysicalDeltaBytes = FMath::Max(Record.PeakUsedPhysicalDeltaBytes, UsedPhysicalDelta);
 	}
 
+	/** The string table receiving the generated entries **/
+	UStringTable* StringTable;
+
+	/** The settings of the generation **/
+	UStringTableGenerationSettings* Settings;
+
+	/** Normalized source string -> key, only filled when bDedupNormalizedTexts is set **/
+	TMap<FString, FString> NormalizedIndex;
+
+	/** The string tables the already localized texts are copied from, resolved once per table id **/
+	TMap<FName, FStringTableConstPtr> SourceStringTables;
+
+	/** The text property paths already discovered for each struct or class **/
+	TMap<FObjectKey, TArray<FString>> TextPropertyPaths;
+
+	/** Physical memory used by the process when the generation started, the memory metrics are relative to it **/
+	uint64 StartUsedPhysical;
+
+	/** Did the generation add or change any entry of the string table **/
+	bool bStringTableModified = false;
+
+	/** Metrics of the generation, appended to the history at the end **/
+	FStringTableGenerationRecord Record;
+
+	/** Are the texts of the processed assets recorded for the gather manifest **/
+	bool bRecordManifest;
+
+	/** Path of the DataTable or asset being processed **/
+	FString CurrentAssetPath;
+
+	/** Paths of all the DataTables and assets processed **/
+	TSet<FString> ProcessedAssets;
+
+	/** The texts linked to the string table, written to its gather manifest at the end **/
+	TArray<FStringTableGatherManifestEntry> ManifestEntries;
+
+	/** The localizable texts not linked to any string table, written to the gather manifest at the end **/
+	TArray<FStringTableGatherManifestText> ManifestTexts;
+};
+
+void UStringTableGenerator::GenerateStringTableContent(UStringTableGenerationSettings* Settings)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	//Create or load string
+	UStringTable* StringTable = ResolveStringTable(Settings);
 	if (StringTable == nullptr)
 	{
 		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("Failed to create or load String Table.")));
 		return;
 	}
 
+	FStringTableGenerationContext Context(StringTable, Settings);
+	Context.Record.ResolveSeconds = FPlatformTime::Seconds() - StartTime;
+	Context.Record.Source = Settings->SourceDataTable->GetPathName();
+
+	{
+		FScopedDurationTimer GenerateTimer(Context.Record.GenerateSeconds);
+		InitGenerationContext(Context);
+
+		//Get the properties to save
+		TArray<FString> PropertyPaths = Settings->bSaveAllProperties ? Settings->AllPropertyNames : TArray<FString>{ Settings->PropertyName };
+
+		if (GenerateEntriesForDataTable(Settings->SourceDataTable, PropertyPaths, Context))
+		{
+			Settings->SourceDataTable->MarkPackageDirty();
+		}
+		Context.SampleMemory();
+	}
+
+	FString CompletedMsg = TEXT("String Table Generation Completed!");
+	{
+		FScopedDurationTimer FinalizeTimer(Context.Record.FinalizeSeconds);
+		UStringTableLookup* Lookup = nullptr;
+		if (Context.bStringTableModified)
+		{
+			StringTable->MarkPackageDirty();
+
+			if (Settings->bBakeLookupTable)
+			{
+				Lookup = UpdateLookupTable(StringTable);
+			}
+		}
+
+		//Save the DataTable, the string table and its lookup together, the gather manifest can only describe saved assets
+		if (Settings->bSaveModifiedPackages || Settings->bWriteGatherManifest)
+		{
+			TArray<UPackage*> ModifiedPackages;
+			for (UObject* ModifiedObject : { (UObject*)Settings->SourceDataTable, (UObject*)StringTable, (UObject*)Lookup })
+			{
+				if (ModifiedObject != nullptr && ModifiedObject->GetPackage()->IsDirty())
+				{
+					ModifiedPackages.Add(ModifiedObject->GetPackage());
+				}
+			}
+
+			TArray<UPackage*> FailedPackages;
+			if (!SaveModifiedPackages(ModifiedPackages, FailedPackages))
+			{
+				CompletedMsg = TEXT("String Table Generation Completed, but these packages failed to save (see the output log for details):\n");
+				for (UPackage* FailedPackage : FailedPackages)
+				{
+					CompletedMsg.Appendf(TEXT("\n%s"), *FailedPackage->GetName());
+				}
+			}
+		}
+
+		if (Settings->bWriteGatherManifest)
+		{
+			//The packages that failed to save stay dirty
+			TSet<FString> UnsavedPackageNames;
+			for (UObject* GeneratedObject : { (UObject*)Settings->SourceDataTable, (UObject*)StringTable })
+			{
+				if (GeneratedObject->GetPackage()->IsDirty())
+				{
+					UnsavedPackageNames.Add(GeneratedObject->GetPackage()->GetName());
+				}
+			}
+
+			if (!WriteGatherManifest(Context, UnsavedPackageNames))
+			{
+				CompletedMsg.Append(TEXT("\n\nThe gather manifest wasn't updated since the DataTable or the String Table failed to save."));
+			}
+		}
+		RefreshStringTableEditor(StringTable, Context.bStringTableModified);
+	}
+
+	RecordGenerationMetrics(Context, StartTime);
+
+	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(CompletedMsg));
+}
+
+bool UStringTableGenerator::GenerateStringTableContentForAssets(const FARFilter& Filter, UStringTableGenerationSettings* Settings)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	UStringTable* StringTable = ResolveStringTable(Settings);
+	if (StringTable == nullptr)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to create or load String Table."));
+		return false;
+	}
+
+	//Keep the settings and the string table alive while the garbage is collected between batches
+	FGCObjectScopeGuard SettingsGuard(Settings);
+	FGCObjectScopeGuard StringTableGuard(StringTable);
+
+	FStringTableGenerationContext Context(StringTable, Settings);
+	Context.Record.ResolveSeconds = FPlatformTime::Seconds() - StartTime;
+	Context.Record.Source = FString::JoinBy(Filter.PackagePaths, TEXT("+"), [](const FName& PackagePath) { return PackagePath.ToString(); });
+
+	{
+		FScopedDurationTimer GenerateTimer(Context.Record.GenerateSeconds);
+		InitGenerationContext(Context);
+	}
+
+	//Find the assets matching the filter, only the filtered paths are scanned
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	TArray<FString> ScanPaths;
+	for (const FName& PackagePath : Filter.PackagePaths)
+	{
+		ScanPaths.Add(PackagePath.ToString());
+	}
+	AssetRegistry.ScanPathsSynchronous(ScanPaths);
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	//Skip the assets whose class can't hold any text before loading them, classes that aren't loaded yet are checked after loading
+	Assets.RemoveAll([&Context](const FAssetData& AssetData)
+	{
+		UClass* AssetClass = AssetData.GetClass();
+		return AssetClass != nullptr
+			&& !AssetClass->IsChildOf<UBlueprint>()
+			&& !AssetClass->IsChildOf<UDataTable>()
+			&& GetTextPropertyPaths(AssetClass, Context).IsEmpty();
+	});
+
+	const int32 BatchSize = FMath::Max(1, Settings->AssetBatchSize);
+	int32 ModifiedAssetCount = 0;
+	TArray<FString> FailedPackageNames;
+	for (int32 BatchStart = 0; BatchStart < Assets.Num(); BatchStart += BatchSize)
+	{
+		const int32 BatchEnd = FMath::Min(BatchStart + BatchSize, Assets.Num());
+
+		//Request the whole batch at once so the packages are loaded asynchronously side by side
+		{
+			FScopedDurationTimer LoadTimer(Context.Record.LoadSeconds);
+			for (int32 i = BatchStart; i < BatchEnd; ++i)
+			{
+				LoadPackageAsync(Assets[i].PackageName.ToString());
+			}
+			FlushAsyncLoading();
+		}
+		Context.SampleMemory();
+
+		//Track the changes of this batch alone, the string table is saved with every batch that changed it
+		const bool bStringTableModifiedBefore = Context.bStringTableModified;
+		Context.bStringTableModified = false;
+
+		TArray<UPackage*> ModifiedPackages;
+		{
+			FScopedDurationTimer GenerateTimer(Context.Record.GenerateSeconds);
+			for (int32 i = BatchStart; i < BatchEnd; ++i)
+			{
+				UObject* Asset = Assets[i].FastGetAsset(false);
+				if (Asset != nullptr && GenerateEntriesForAsset(Asset, Context))
+				{
+					Asset->MarkPackageDirty();
+					ModifiedPackages.Add(Asset->GetPackage());
+				}
+			}
+		}
+		Context.SampleMemory();
+
+		const bool bBatchModifiedStringTable = Context.bStringTableModified;
+		Context.bStringTableModified |= bStringTableModifiedBefore;
+
+		//Save the batch before releasing it, the garbage collection would throw the changes away
+		FScopedDurationTimer FinalizeTimer(Context.Record.FinalizeSeconds);
+		if (bBatchModifiedStringTable || StringTable->GetPackage()->IsDirty())
+		{
+			//The string table is saved first, so the saved assets never link to keys missing on disk
+			StringTable->MarkPackageDirty();
+
+			TArray<UPackage*> FailedPackages;
+			if (!SaveModifiedPackages({ StringTable->GetPackage() }, FailedPackages))
+			{
+				FailedPackageNames.AddUnique(StringTable->GetPackage()->GetName());
+
+				//Their changes are released with the batch, the next run generates them again
+				for (UPackage* ModifiedPackage : ModifiedPackages)
+				{
+					FailedPackageNames.Add(ModifiedPackage->GetName());
+				}
+				ModifiedPackages.Reset();
+			}
+		}
+
+		if (!ModifiedPackages.IsEmpty())
+		{
+			TArray<UPackage*> FailedPackages;
+			SaveModifiedPackages(ModifiedPackages, FailedPackages);
+			ModifiedAssetCount += ModifiedPackages.Num();
+
+			//Only the names are kept, the packages are released by the garbage collection below
+			for (UPackage* FailedPackage : FailedPackages)
+			{
+				FailedPackageNames.Add(FailedPackage->GetName());
+			}
+		}
+
+		//The loaded assets are standalone in the editor, no flag is kept so the batch is actually released
+		CollectGarbage(RF_NoFlags);
+	}
+
+	//The lookup is baked once from the final string table
+	if (Context.bStringTableModified && Settings->bBakeLookupTable)
+	{
+		FScopedDurationTimer FinalizeTimer(Context.Record.FinalizeSeconds);
+		if (UStringTableLookup* Lookup = UpdateLookupTable(StringTable))
+		{
+			TArray<UPackage*> FailedPackages;
+			SaveModifiedPackages({ Lookup->GetPackage() }, FailedPackages);
+			for (UPackage* FailedPackage : FailedPackages)
+			{
+				FailedPackageNames.Add(FailedPackage->GetName());
+			}
+		}
+	}
+
+	if (Settings->bWriteGatherManifest)
+	{
+		FScopedDurationTimer FinalizeTimer(Context.Record.FinalizeSeconds);
+		WriteGatherManifest(Context, TSet<FString>(FailedPackageNames));
+	}
+
+	RecordGenerationMetrics(Context, StartTime);
+
+	UE_LOG(LogTemp, Display, TEXT("String Table Generation Completed: %d assets scanned, %d assets modified."), Assets.Num(), ModifiedAssetCount);
+	if (!FailedPackageNames.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("%d packages failed to save:\n%s"), FailedPackageNames.Num(), *FString::Join(FailedPackageNames, TEXT("\n")));
+		return false;
+	}
+
+	return true;
+}
+
+void UStringTableGenerator::GenerateStringTableEntries(UStringTable* StringTable, UStringTableGenerationSettings* Settings)
+{
+	FStringTableGenerationContext Context(StringTable, Settings);
+	Context.bRecordManifest = false;
+	InitGenerationContext(Context);
+
+	TArray<FString> PropertyPaths = Settings->bSaveAllProperties ? Settings->AllPropertyNames : TArray<FString>{ Settings->PropertyName };
+	GenerateEntriesForDataTable(Settings->SourceDataTable, PropertyPaths, Context);
+}
+
+UStringTableLookup* UStringTableGenerator::UpdateLookupTable(UStringTable* StringTable)
+{
+	//The lookup is stored next to its string table
+	const FString PackageName = StringTable->GetPackage()->GetName() + TEXT("_Lookup");
+	const FString AssetName = FPackageName::GetShortName(PackageName);
+
+	UStringTableLookup* Lookup = LoadObject<UStringTableLookup>(nullptr, *(PackageName + "." + AssetName), nullptr, LOAD_NoWarn | LOAD_Quiet);
+	if (Lookup == nullptr)
+	{
+		UPackage* Package = CreatePackage(*PackageName);
+		Lookup = NewObject<UStringTableLookup>(Package, *AssetName, RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(Lookup);
+	}
+
+	Lookup->SourceStringTable = StringTable;
+	Lookup->Rebuild();
+	Lookup->MarkPackageDirty();
+	return Lookup;
+}
+
+bool UStringTableGenerator::SaveModifiedPackages(const TArray<UPackage*>& Packages, TArray<UPackage*>& OutFailedPackages)
+{
+	if (Packages.IsEmpty())
+	{
+		return true;
+	}
+
+	//The files are read-only until checked out on projects using source control
+	if (ISourceControlModule::Get().IsEnabled())
+	{
+		FEditorFileUtils::CheckoutPackages(Packages, nullptr, false);
+	}
+
+	//The packages are serialized one by one on the game thread, but their files are all written in the background at the same time
+	TArray<ESavePackageResult> Results;
+	for (UPackage* Package : Packages)
+	{
+		const FString Filename = FPackageName::LongPackageNameToFilename(Package->GetName(), Package->ContainsMap() ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
+
+		//Files that couldn't be checked out are made writable, like the editor does when saving them
+		if (IFileManager::Get().IsReadOnly(*Filename))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s is read-only, making it writable"), *Filename);
+			FPlatformFileManager::Get().GetPlatformFile().SetReadOnly(*Filename, false);
+		}
+
+		//Maps are saved from their world, the other packages from their public assets
+		UWorld* World = UWorld::FindWorldInPackage(Package);
+
+		FSavePackageArgs SaveArgs;
+		SaveArgs.TopLevelFlags = World ? RF_NoFlags : RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_Async | SAVE_NoError;
+		SaveArgs.Error = GWarn;
+		Results.Add(UPackage::Save(Package, World, *Filename, SaveArgs).Result);
+	}
+
+	//Wait for all the files to be written before reporting
+	UPackage::WaitForAsyncFileWrites();
+
+	for (int32 i = 0; i < Packages.Num(); ++i)
+	{
+		if (Results[i] == ESavePackageResult::Success)
+		{
+			UE_LOG(LogTemp, Display, TEXT("Saved %s"), *Packages[i]->GetName());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to save %s (result %d)"), *Packages[i]->GetName(), (int32)Results[i]);
+			OutFailedPackages.Add(Packages[i]);
+		}
+	}
+
+	return OutFailedPackages.IsEmpty();
+}
+
+bool UStringTableGenerator::WriteGatherManifest(FStringTableGenerationContext& Context, const TSet<FString>& UnsavedPackageNames)
+{
+	//The manifest describes the saved assets, the gather can't find keys that only exist in memory
+	const FString StringTablePackageName = Context.StringTable->GetPackage()->GetName();
+	if (UnsavedPackageNames.Contains(StringTablePackageName))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("The String Table %s isn't saved, its gather manifest isn't updated"), *StringTablePackageName);
+		return false;
+	}
+
+	//The assets that aren't saved keep their previous records
+	auto IsUnsaved = [&UnsavedPackageNames](const FString& AssetPath)
+	{
+		return UnsavedPackageNames.Contains(FPackageName::ObjectPathToPackageName(AssetPath));
+	};
+
+	const int32 ProcessedCount = Context.ProcessedAssets.Num();
+	for (auto It = Context.ProcessedAssets.CreateIterator(); It; ++It)
+	{
+		if (IsUnsaved(*It))
+		{
+			It.RemoveCurrent();
+		}
+	}
+	Context.ManifestEntries.RemoveAll([&IsUnsaved](const FStringTableGatherManifestEntry& Entry) { return IsUnsaved(Entry.SourceAsset); });
+	Context.ManifestTexts.RemoveAll([&IsUnsaved](const FStringTableGatherManifestText& Text) { return IsUnsaved(Text.SourceAsset); });
+
+	if (Context.ProcessedAssets.Num() != ProcessedCount)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%d assets aren't saved, their records in the gather manifest aren't updated"), ProcessedCount - Context.ProcessedAssets.Num());
+	}
+
+	if (Context.ProcessedAssets.IsEmpty())
+	{
+		return false;
+	}
+
+	if (!FStringTableGatherManifests::UpdateManifest(Context.StringTable, Context.ProcessedAssets, MoveTemp(Context.ManifestEntries), MoveTemp(Context.ManifestTexts)))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to update the gather manifest %s"), *FStringTableGatherManifests::GetManifestFilePath(Context.StringTable));
+		return false;
+	}
+
+	return true;
+}
+
+void UStringTableGenerator::RecordGenerationMetrics(FStringTableGenerationContext& Context, double StartTime)
+{
+	FStringTableGenerationRecord& Record = Context.Record;
+	Record.Date = FDateTime::UtcNow().ToIso8601();
+	Record.StringTable = Context.StringTable->GetPathName();
+	Record.TotalSeconds = FPlatformTime::Seconds() - StartTime;
+	Context.SampleMemory();
+	Record.UsedPhysicalDeltaBytes = (int64)FPlatformMemory::GetStats().UsedPhysical - (int64)Context.StartUsedPhysical;
+
+	FStringTableGenerationHistory::AppendRecord(Record);
+
+	UE_LOG(LogTemp, Display, TEXT("String Table Generation: %d rows, %d texts, %d new keys, %d dedup hits, %d collision probes in %.3fs"),
+		Record.RowCount, Record.TextCount, Record.NewKeyCount, Record.DedupHitCount, Record.CollisionProbeCount, Record.TotalSeconds);
+}
+
+const TArray<FString>& UStringTableGenerator::GetTextPropertyPaths(const UStruct* Struct, FStringTableGenerationContext& Context)
+{
+	if (TArray<FString>* CachedPaths = Context.TextPropertyPaths.Find(FObjectKey(Struct)))
+	{
+		return *CachedPaths;
+	}
+
+	//Reuse the paths discovered by a previous run of the same profile
+	UStringTableGenerationProfile* Profile = Context.Settings->Profile;
+	if (const TArray<FString>* ResolvedPaths = Profile ? Profile->FindResolvedTextPropertyPaths(Struct) : nullptr)
+	{
+		return Context.TextPropertyPaths.Add(FObjectKey(Struct), *ResolvedPaths);
+	}
+
+	TArray<FString>& Paths = Context.TextPropertyPaths.Add(FObjectKey(Struct));
+	GetAllTextPropertiesRecursive(Struct, "", Paths);
+
+	if (Profile != nullptr)
+	{
+		Profile->SetResolvedTextPropertyPaths(Struct, Paths);
+	}
+
+	return Paths;
+}
+
+TArray<FString> UStringTableGenerator::GetPropertyPathsToSave(const UStruct* Struct, FStringTableGenerationContext& Context)
+{
+	const TArray<FString>& AllPaths = GetTextPropertyPaths(Struct, Context);
+	if (Context.Settings->bSaveAllProperties)
+	{
+		return AllPaths;
+	}
+
+	//Only keep the selected property when this struct has it
+	if (AllPaths.Contains(Context.Settings->PropertyName))
+	{
+		return { Context.Settings->PropertyName };
+	}
+
+	return {};
+}
+
+void UStringTableGenerator::InitGenerationContext(FStringTableGenerationContext& Context)
+{
+	//Index the existing entries once so the normalized dedup doesn't walk the whole table for every text
+	if (Context.Settings->bDedupNormalizedTexts)
+	{
+		BuildNormalizedSourceStringIndex(Context.StringTable, Context.NormalizedIndex);
+	}
+}
+
+bool UStringTableGenerator::GenerateEntriesForAsset(UObject* Asset, FStringTableGenerationContext& Context)
+{
+	Context.CurrentAssetPath = Asset->GetPathName();
+	Context.ProcessedAssets.Add(Context.CurrentAssetPath);
+
+	if (UDataTable* DataTable = Cast<UDataTable>(Asset))
+	{
+		return GenerateEntriesForDataTable(DataTable, GetPropertyPathsToSave(DataTable->GetRowStruct(), Context), Context);
+	}
+
+	//The texts of a blueprint are stored into the default object of its generated class
+	UObject* TargetObject = Asset;
+	if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+	{
+		TargetObject = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetDefaultObject() : nullptr;
+	}
+
+	if (TargetObject == nullptr)
+	{
+		return false;
+	}
+
+	bool bModified = false;
+	TArray<FString> PropertyPaths = GetPropertyPathsToSave(TargetObject->GetClass(), Context);
+	if (!PropertyPaths.IsEmpty())
+	{
+		Context.Record.RowCount++;
+		bModified = GenerateEntriesForContainer(TargetObject, TargetObject->GetClass(), Asset->GetName(), PropertyPaths, Context);
+	}
+
+	if (Context.bRecordManifest)
+	{
+		AddManifestTexts(TargetObject, TargetObject->GetClass(), Asset->GetName(), Context);
+	}
+	return bModified;
+}
+
+bool UStringTableGenerator::GenerateEntriesForDataTable(UDataTable* DataTable, const TArray<FString>& PropertyPaths, FStringTableGenerationContext& Context)
+{
+	Context.CurrentAssetPath = DataTable->GetPathName();
+	Context.ProcessedAssets.Add(Context.CurrentAssetPath);
+
+	if (PropertyPaths.IsEmpty() && !Context.bRecordManifest)
+	{
+		return false;
+	}
+
 	//Get DataTable rows
-	TArray<FName> TableRowsName = Settings->SourceDataTable->GetRowNames();
+	TArray<FName> TableRowsName = DataTable->GetRowNames();
+
+	const UScriptStruct* DtStruct = DataTable->GetRowStruct();
 
-	const UScriptStruct* DtStruct = Settings->SourceDataTable->GetRowStruct();
 	//Loop over rows
+	bool bModified = false;
 	for (FName& RowName : TableRowsName)
 	{
-		FTableRowBase* TableRow = Settings->SourceDataTable->FindRow<FTableRowBase>(RowName, TEXT("String Table Generation"));
+		FTableRowBase* TableRow = DataTable->FindRow<FTableRowBase>(RowName, TEXT("String Table Generation"));
 		if (TableRow == nullptr)
 		{
 			continue;
 		}
 
-		//Get the properties to save
-		TArray<FText*> PropertiesToSave;
-		if (Settings->bSaveAllProperties)
+		if (!PropertyPaths.IsEmpty())
 		{
-			GetPropertiesToSave(TableRow, DtStruct, Settings->AllPropertyNames, PropertiesToSave);
+			Context.Record.RowCount++;
+
+			bModified |= GenerateEntriesForContainer(TableRow, DtStruct, RowName.ToString(), PropertyPaths, Context);
 		}
-		else
+
+		//Every text of the row is recorded, even the ones that weren't selected, so the gather can leave the DataTable out
+		if (Context.bRecordManifest)
 		{
-			GetPropertiesToSave(TableRow, DtStruct,{ Settings->PropertyName }, PropertiesToSave);
+			AddManifestTexts(TableRow, DtStruct, RowName.ToString(), Context);
 		}
+	}
+
+	return bModified;
+}
 
-		for (FText* Text : PropertiesToSave)
+bool UStringTableGenerator::GenerateEntriesForContainer(void* Container, const UStruct* Struct, const FString& RowName, const TArray<FString>& PropertyPaths, FStringTableGenerationContext& Context)
+{
+	UStringTable* StringTable = Context.StringTable;
+	UStringTableGenerationSettings* Settings = Context.Settings;
+
+	//Get the properties to save
+	TArray<FText*> PropertiesToSave;
+	GetPropertiesToSave(Container, Struct, PropertyPaths, PropertiesToSave);
+	Context.Record.TextCount += PropertiesToSave.Num();
+
+	//The new keys are named after the selected property, or after the first text property like the settings window does by default
+	const FString& KeyPropertyName = Settings->PropertyName.IsEmpty() && !PropertyPaths.IsEmpty() ? PropertyPaths[0] : Settings->PropertyName;
+
+	bool bModified = false;
+	for (int32 TextIndex = 0; TextIndex < PropertiesToSave.Num(); ++TextIndex)
+	{
+		FText* Text = PropertiesToSave[TextIndex];
+
+		//Check if the property is already localized
+		FString ExistingKey; 
+		FName TableID;
+		if (FTextInspector::GetTableIdAndKey(*Text, TableID, ExistingKey))
 		{
-			//Check if the property is already localized
-			FString ExistingKey; 
-			FName TableID;
-			if (FTextInspector::GetTableIdAndKey(*Text, TableID, ExistingKey))
+			//The localize string is already in the correct String Table
+			if (TableID == StringTable->GetStringTableId())
 			{
-				//The localize string is already in the correct String Table
-				if (!Settings->bCopyAlreadyLocalizedKeys || TableID == StringTable->GetStringTableId())
-				{
-					continue;
-				}
+				continue;
+			}
 
-				//Copy the Key into the new String Table and link the text to the new string table
-				StringTable->GetMutableStringTable()->SetSourceString(ExistingKey, Text->ToString());
-				*Text = FText::FromStringTable(StringTable->GetStringTableId(), ExistingKey);
+			if (!Settings->bCopyAlreadyLocalizedKeys)
+			{
+				continue;
 			}
-			else //Property not localized
+
+			//Copy the Key into the new String Table and link the text to the new string table
+			Context.bStringTableModified |= CopyStringTableEntry(TableID, ExistingKey, *Text, Context);
+			*Text = FText::FromStringTable(StringTable->GetStringTableId(), ExistingKey);
+			Context.Record.CopiedKeyCount++;
+		}
+		else //Property not localized
+		{
+			//Check if a string exists with the same text, if not we create a new one
+			FString Key;
+			FString NormalizedValue;
+			if (Settings->bDedupNormalizedTexts)
 			{
-				//Check if a string exists with the same text, if not we create a new one
-				FString Key = FindValueInStringTable(StringTable, Text->ToString());
+				NormalizedValue = NormalizeSourceString(Text->ToString());
+				Key = FindNormalizedValueInStringTable(StringTable, Context.NormalizedIndex, NormalizedValue);
+			}
+			else
+			{
+				Key = FindValueInStringTable(StringTable, Text->ToString());
+			}
+
+			if (Key.IsEmpty())
+			{
+				//Create a new string table entry for this Text
+				Key = CreateNewKeyName(RowName, KeyPropertyName, StringTable, Settings, Context.Record.CollisionProbeCount);
 				if (Key.IsEmpty())
 				{
-					//Create a new string table entry for this Text
-					Key = CreateNewKeyName(RowName.ToString(), StringTable, Settings);
-					StringTable->GetMutableStringTable()->SetSourceString(Key, Text->ToString());
+					UE_LOG(LogTemp, Error, TEXT("Failed to create a key for the text \"%s\" of %s, the text is skipped"), *Text->ToString(), *RowName);
+					continue;
 				}
 
-				//Link the text to the matching key from the string table
-				*Text = FText::FromStringTable(StringTable->GetStringTableId(), Key);
+				StringTable->GetMutableStringTable()->SetSourceString(Key, Text->ToString());
+				Context.Record.NewKeyCount++;
+				Context.bStringTableModified = true;
+
+				if (Settings->bDedupNormalizedTexts)
+				{
+					Context.NormalizedIndex.Add(NormalizedValue, Key);
+				}
 			}
+			else
+			{
+				Context.Record.DedupHitCount++;
+			}
+
+			//Link the text to the matching key from the string table
+			*Text = FText::FromStringTable(StringTable->GetStringTableId(), Key);
 		}
+
+		//The text was unlinked or linked to another table, it now points to the generated one
+		bModified = true;
 	}
 
-	RefreshStringTableEditor(StringTable);
+	return bModified;
+}
+
+void UStringTableGenerator::AddManifestTexts(void* Container, const UStruct* Struct, const FString& RowName, FStringTableGenerationContext& Context)
+{
+	TArray<FText*> Texts;
+	TArray<const FString*> TextPropertyPaths;
+	GetPropertiesToSave(Container, Struct, GetTextPropertyPaths(Struct, Context), Texts, &TextPropertyPaths);
+
+	for (int32 TextIndex = 0; TextIndex < Texts.Num(); ++TextIndex)
+	{
+		const FText& Text = *Texts[TextIndex];
+
+		FName TableId;
+		FString Key;
+		if (FTextInspector::GetTableIdAndKey(Text, TableId, Key))
+		{
+			//The texts of other string tables are gathered with their own table
+			if (TableId == Context.StringTable->GetStringTableId())
+			{
+				//The source string is filled from the string table when the manifest is written
+				FStringTableGatherManifestEntry& Entry = Context.ManifestEntries.AddDefaulted_GetRef();
+				Entry.Key = Key;
+				Entry.SourceAsset = Context.CurrentAssetPath;
+				Entry.Row = RowName;
+				Entry.PropertyPath = *TextPropertyPaths[TextIndex];
+			}
+			continue;
+		}
+
+		//Keep the texts the asset gather would have found
+		TOptional<FString> Namespace = FTextInspector::GetNamespace(Text);
+		TOptional<FString> TextKey = FTextInspector::GetKey(Text);
+		const FString* SourceString = FTextInspector::GetSourceString(Text);
+		if (!Text.ShouldGatherForLocalization() || !Namespace.IsSet() || !TextKey.IsSet() || SourceString == nullptr)
+		{
+			continue;
+		}
 
-	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(TEXT("String Table Generation Completed!")));
+		FStringTableGatherManifestText& ManifestText = Context.ManifestTexts.AddDefaulted_GetRef();
+		ManifestText.Namespace = Namespace.GetValue();
+		ManifestText.Key = TextKey.GetValue();
+		ManifestText.SourceString = *SourceString;
+		ManifestText.SourceAsset = Context.CurrentAssetPath;
+		ManifestText.Row = RowName;
+		ManifestText.PropertyPath = *TextPropertyPaths[TextIndex];
+	}
 }
 
 bool UStringTableGenerator::ValidateGenerationSettings(UStringTableGenerationSettings* Settings)
@@ -131,7 +787,7 @@ bool UStringTableGenerator::ValidateGenerationSettings(UStringTableGenerationSet
 			InvalidSettingsMsg.Append(TEXT("- Property name shouldn't be empty\n"));
 			bIsValid = false;
 		}
-		else
+		else if (Settings->SourceDataTable != nullptr)
 		{
 			//Check that there's a property with this name is the DataTable's data structure
 			const UScriptStruct* DTStruct = Settings->SourceDataTable->GetRowStruct();
@@ -153,7 +809,7 @@ bool UStringTableGenerator::ValidateGenerationSettings(UStringTableGenerationSet
 		else
 		{
 			//Check that the name is valid to create an asset
-			FString PackagePath = TEXT("/Game/CrisisUnit/StringTables/" + Settings->NewStringTableName);
+			FString PackagePath = Settings->StringTableFolder / Settings->NewStringTableName;
 			if (!FPackageName::IsValidObjectPath(PackagePath))
 			{
 				InvalidSettingsMsg.Append(TEXT("- New String Table name is not a valid asset name. It shouldn't contain any whitespace or special characters\n"));
@@ -185,12 +841,49 @@ bool UStringTableGenerator::ValidateGenerationSettings(UStringTableGenerationSet
 	return bIsValid;
 }
 
-FTextProperty* UStringTableGenerator::GetPropertyFromPropertyPath(const UScriptStruct* BaseStruct, FString& PropertyPath)
+void UStringTableGenerator::GetAllTextPropertiesRecursive(const UStruct* Struct, FString ChainString, TArray<FString>& OutTextProperties)
+{
+	FString DotChar = ChainString.IsEmpty() ? "" : ".";
+	// Iterate all properties of the struct
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		FProperty* Property = *It;
+		FString CurrentString = ChainString + DotChar + Property->GetName();
+
+		// If this property is a text property, add it to the output array
+		if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+		{
+			OutTextProperties.Add(CurrentString);
+		}
+		// If this property is a struct property, recursively search in it
+		else if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+		{
+			GetAllTextPropertiesRecursive(StructProperty->Struct, CurrentString, OutTextProperties);
+		}
+		// If this property is a container (array, map, set or optional), look at the type of its items
+		else if (FProperty* InnerProperty = GetContainerItemProperty(Property))
+		{
+			// If this property is a text property, add it to the output array
+			if (FTextProperty* InnerTextProperty = CastField<FTextProperty>(InnerProperty))
+			{
+				OutTextProperties.Add(CurrentString);
+			}
+			// If this property is a struct property, recursively search in it
+			else if (FStructProperty* InnerStructProperty = CastField<FStructProperty>(InnerProperty))
+			{
+				GetAllTextPropertiesRecursive(InnerStructProperty->Struct, CurrentString, OutTextProperties);
+			}
+		}
+	}
+
+}
+
+FTextProperty* UStringTableGenerator::GetPropertyFromPropertyPath(const UStruct* BaseStruct, FString& PropertyPath)
 {
 	TArray<FString> PropertyNames;
 	PropertyPath.ParseIntoArray(PropertyNames, TEXT("."));
 
-	const UScriptStruct* CurrentStruct = BaseStruct;
+	const UStruct* CurrentStruct = BaseStruct;
 	FProperty* CurrentProperty = nullptr;
 	for (FString PropertyName : PropertyNames)
 	{
@@ -200,13 +893,13 @@ FTextProperty* UStringTableGenerator::GetPropertyFromPropertyPath(const UScriptS
 		{
 			CurrentStruct = StructProperty->Struct;
 		}
-		else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(CurrentProperty))
+		else if (FProperty* ItemProperty = GetContainerItemProperty(CurrentProperty))
 		{
-			CurrentProperty = ArrayProperty->Inner;
+			CurrentProperty = ItemProperty;
 
-			if (FStructProperty* ArrayStructProperty = CastField<FStructProperty>(CurrentProperty))
+			if (FStructProperty* ItemStructProperty = CastField<FStructProperty>(CurrentProperty))
 			{
-				CurrentStruct = ArrayStructProperty->Struct;
+				CurrentStruct = ItemStructProperty->Struct;
 			}
 		}
 		else
@@ -223,10 +916,56 @@ FTextProperty* UStringTableGenerator::GetPropertyFromPropertyPath(const UScriptS
 	return nullptr;
 }
 
-UStringTable* UStringTableGenerator::CreateStringTable(FString& TableName)
+FProperty* UStringTableGenerator::GetContainerItemProperty(FProperty* ContainerProperty)
+{
+	if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(ContainerProperty))
+	{
+		return ArrayProperty->Inner;
+	}
+	else if (FMapProperty* MapProperty = CastField<FMapProperty>(ContainerProperty))
+	{
+		return MapProperty->ValueProp;
+	}
+	else if (FSetProperty* SetProperty = CastField<FSetProperty>(ContainerProperty))
+	{
+		return SetProperty->ElementProp;
+	}
+	else if (FOptionalProperty* OptionalProperty = CastField<FOptionalProperty>(ContainerProperty))
+	{
+		return OptionalProperty->GetValueProperty();
+	}
+
+	return nullptr;
+}
+
+UStringTable* UStringTableGenerator::ResolveStringTable(UStringTableGenerationSettings* Settings)
+{
+	//The profile already resolved this table during a previous run
+	UStringTableGenerationProfile* Profile = Settings->Profile;
+	if (Profile != nullptr && Settings->bCreateNewStringTable)
+	{
+		if (UStringTable* ResolvedStringTable = Profile->GetResolvedStringTable(Settings))
+		{
+			return ResolvedStringTable;
+		}
+	}
+
+	UStringTable* StringTable = Settings->bCreateNewStringTable
+		? CreateStringTable(Settings->NewStringTableName, Settings->StringTableFolder)
+		: Settings->ExistingStringTable.Get();
+
+	if (Profile != nullptr && StringTable != nullptr)
+	{
+		Profile->SetResolvedStringTable(StringTable);
+	}
+
+	return StringTable;
+}
+
+UStringTable* UStringTableGenerator::CreateStringTable(const FString& TableName, const FString& Folder)
 {
 	//Try to load the asset in case it already exist
-	FString AssetPath = TEXT("/Game/CrisisUnit/StringTables/" + TableName + "." + TableName);
+	FString AssetPath = Folder / TableName + "." + TableName;
 	UClass* AssetClass = UStringTable::StaticClass();
 
 	UObject* LoadedAsset = StaticLoadObject(AssetClass, nullptr, *AssetPath);
@@ -244,32 +983,45 @@ UStringTable* UStringTableGenerator::CreateStringTable(FString& TableName)
 	StringTableFactory->AddToRoot(); // Ensure factory does not get GC'd during this operation
 
 	// Create the asset
-	UObject* CreatedAsset = AssetTools.CreateAsset(TableName, TEXT("/Game/CrisisUnit/StringTables/"), UStringTable::StaticClass(), StringTableFactory);
+	UObject* CreatedAsset = AssetTools.CreateAsset(TableName, Folder, UStringTable::StaticClass(), StringTableFactory);
 
 	StringTableFactory->RemoveFromRoot();
 
 	return Cast<UStringTable>(CreatedAsset);
 }
 
-void UStringTableGenerator::GetPropertiesToSave(FTableRowBase* DataTableRow, const UScriptStruct* DtStruct, TArray<FString> PropertyPaths, TArray<FText*>& OutTextsToSave)
+void UStringTableGenerator::GetPropertiesToSave(void* Container, const UStruct* Struct, const TArray<FString>& PropertyPaths, TArray<FText*>& OutTextsToSave, TArray<const FString*>* OutTextPropertyPaths)
 {
-	for (FString& PropertyPath : PropertyPaths)
+	for (const FString& PropertyPath : PropertyPaths)
 	{
-		for (FText* TextValue : GetPropertyValuesFromPropertyPath(DataTableRow, DtStruct, PropertyPath))
+		for (FText* TextValue : GetPropertyValuesFromPropertyPath(Container, Struct, PropertyPath))
 		{
 			if (TextValue != nullptr)
 			{
 				OutTextsToSave.Add(TextValue);
+
+				if (OutTextPropertyPaths != nullptr)
+				{
+					OutTextPropertyPaths->Add(&PropertyPath);
+				}
 			}
 		}
 	}
 }
 
-TArray<FText*> UStringTableGenerator::GetPropertyValuesFromPropertyPath(FTableRowBase* DataTableRow, const UScriptStruct* DtStruct, FString PropertyPath)
+TArray<FText*> UStringTableGenerator::GetPropertyValuesFromPropertyPath(void* Container, const UStruct* Struct, FString PropertyPath)
 {
+	//Native structs can have a compiled visitor reaching their texts without the reflection
+	if (FStringTableTextVisitorFunc Visitor = FStringTableTextVisitorRegistry::Get().Find(Struct, PropertyPath))
+	{
+		TArray<FText*> Texts;
+		Visitor(Container, Texts);
+		return Texts;
+	}
+
 	//Get the address of all the properties we want to edit
 	TMap<void*, FTextProperty*> PropertiesAddresses;
-	GetPropertyAddresses(DataTableRow, DtStruct, PropertyPath, PropertiesAddresses);
+	GetPropertyAddresses(Container, Struct, PropertyPath, PropertiesAddresses);
 
 	//Get the values from the addresses
 	TArray<FText*> Texts;
@@ -288,14 +1040,14 @@ TArray<FText*> UStringTableGenerator::GetPropertyValuesFromPropertyPath(FTableRo
 	return Texts;
 }
 
-void UStringTableGenerator::GetPropertyAddresses(void* StartingObjects, const UScriptStruct* DataStruct, FString PropertyPath, TMap<void*, FTextProperty*>& OutAddresses)
+void UStringTableGenerator::GetPropertyAddresses(void* StartingObjects, const UStruct* DataStruct, FString PropertyPath, TMap<void*, FTextProperty*>& OutAddresses)
 {
 	//Split the property path string to get the name of each property
 	TArray<FString> PropertyNames;
 	PropertyPath.ParseIntoArray(PropertyNames, TEXT("."));
 
 	//Initialize variables
-	const UScriptStruct* CurrentStruct = DataStruct;
+	const UStruct* CurrentStruct = DataStruct;
 	FProperty* CurrentProperty = nullptr;
 	void* CurrentAddress = StartingObjects;
 	FString CurrentPropertyPath = "";
@@ -306,6 +1058,10 @@ void UStringTableGenerator::GetPropertyAddresses(void* StartingObjects, const US
 		CurrentProperty = CurrentStruct->FindPropertyByName(FName(PropertyName));
 		CurrentPropertyPath = CurrentPropertyPath.IsEmpty() ? PropertyName : CurrentPropertyPath + "." + PropertyName;
 
+		//The part of the path left to resolve inside the items of a container
+		FString RemainingPropertyPath = PropertyPath.RightChop(CurrentPropertyPath.Len());
+		RemainingPropertyPath.RemoveFromStart(TEXT("."));
+
 		//It's a text we add the address of the object to get the value later
 		if (FTextProperty* TextProperty = CastField<FTextProperty>(CurrentProperty))
 		{
@@ -322,36 +1078,52 @@ void UStringTableGenerator::GetPropertyAddresses(void* StartingObjects, const US
 		else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(CurrentProperty))
 		{
 			FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
-			CurrentProperty = ArrayProperty->Inner;
+			for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+			{
+				GetContainerItemAddresses(ArrayHelper.GetRawPtr(i), ArrayProperty->Inner, RemainingPropertyPath, OutAddresses);
+			}
 
-			//It's an array of FText we add all of them to the address array
-			if (FTextProperty* ArrayTextProperty = CastField<FTextProperty>(CurrentProperty))
+			//The items went through the rest of the property chain, stop here
+			break;
+		}
+		//If it's a map, only the values are visited, editing the keys in place would break the hashes
+		else if (FMapProperty* MapProperty = CastField<FMapProperty>(CurrentProperty))
+		{
+			FScriptMapHelper MapHelper(MapProperty, MapProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
+			for (int32 i = 0; i < MapHelper.GetMaxIndex(); ++i)
 			{
-				for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+				if (MapHelper.IsValidIndex(i))
 				{
-					void* ItemAddress = ArrayHelper.GetRawPtr(i);
-					OutAddresses.Add(ItemAddress, ArrayTextProperty);
+					GetContainerItemAddresses(MapHelper.GetValuePtr(i), MapProperty->ValueProp, RemainingPropertyPath, OutAddresses);
 				}
 			}
-			//It's an array of structs, go through each of them to get the requested property
-			else if (FStructProperty* ArrayStructProperty = CastField<FStructProperty>(CurrentProperty))
-			{
-				CurrentStruct = ArrayStructProperty->Struct;
 
-				//Loop through array items
-				for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+			break;
+		}
+		//If it's a set, visit every element (FText isn't hashable so the texts can't be part of the element hash)
+		else if (FSetProperty* SetProperty = CastField<FSetProperty>(CurrentProperty))
+		{
+			FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
+			for (int32 i = 0; i < SetHelper.GetMaxIndex(); ++i)
+			{
+				if (SetHelper.IsValidIndex(i))
 				{
-					FString CutPropertyPath = PropertyPath;
-					CutPropertyPath.RemoveFromStart(CurrentPropertyPath);
-					CutPropertyPath.RemoveAt(0);
-					
-					void* ItemAddress = ArrayHelper.GetRawPtr(i);
-					GetPropertyAddresses(ItemAddress, CurrentStruct, CutPropertyPath, OutAddresses);
+					GetContainerItemAddresses(SetHelper.GetElementPtr(i), SetProperty->ElementProp, RemainingPropertyPath, OutAddresses);
 				}
+			}
 
-				//The recursive call went through the rest of the property chain, stop here
-				break;
+			break;
+		}
+		//If it's an optional, visit the value only when it is set
+		else if (FOptionalProperty* OptionalProperty = CastField<FOptionalProperty>(CurrentProperty))
+		{
+			void* ValueAddress = OptionalProperty->GetValuePointerForReadOrReplaceIfSet(OptionalProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
+			if (ValueAddress != nullptr)
+			{
+				GetContainerItemAddresses(ValueAddress, OptionalProperty->GetValueProperty(), RemainingPropertyPath, OutAddresses);
 			}
+
+			break;
 		}
 		else
 		{
@@ -360,6 +1132,84 @@ void UStringTableGenerator::GetPropertyAddresses(void* StartingObjects, const US
 	}
 }
 
+void UStringTableGenerator::GetContainerItemAddresses(void* ItemAddress, FProperty* ItemProperty, const FString& RemainingPropertyPath, TMap<void*, FTextProperty*>& OutAddresses)
+{
+	//The item is a text, add it to the address array
+	if (FTextProperty* ItemTextProperty = CastField<FTextProperty>(ItemProperty))
+	{
+		OutAddresses.Add(ItemAddress, ItemTextProperty);
+	}
+	//The item is a struct, get the rest of the property chain inside of it
+	else if (FStructProperty* ItemStructProperty = CastField<FStructProperty>(ItemProperty))
+	{
+		GetPropertyAddresses(ItemAddress, ItemStructProperty->Struct, RemainingPropertyPath, OutAddresses);
+	}
+}
+
+FStringTableConstPtr UStringTableGenerator::FindSourceStringTable(FName TableId, FStringTableGenerationContext& Context)
+{
+	if (const FStringTableConstPtr* SourceStringTable = Context.SourceStringTables.Find(TableId))
+	{
+		return *SourceStringTable;
+	}
+
+	//Make sure the asset of the table is loaded, it may also redirect the id
+	FName ResolvedTableId = TableId;
+	IStringTableEngineBridge::FullyLoadStringTableAsset(ResolvedTableId);
+
+	FStringTableConstPtr SourceStringTable = FStringTableRegistry::Get().FindStringTable(ResolvedTableId);
+	Context.SourceStringTables.Add(TableId, SourceStringTable);
+	return SourceStringTable;
+}
+
+bool UStringTableGenerator::CopyStringTableEntry(FName SourceTableId, const FString& Key, const FText& Text, FStringTableGenerationContext& Context)
+{
+	FStringTableRef DstStringTable = Context.StringTable->GetMutableStringTable();
+
+	//Only write what differs so copying an entry that is already there doesn't modify the table
+	bool bChanged = false;
+	auto SetSourceString = [&](const FString& SourceString)
+	{
+		FString ExistingSourceString;
+		if (!DstStringTable->GetSourceString(Key, ExistingSourceString) || !ExistingSourceString.Equals(SourceString, ESearchCase::CaseSensitive))
+		{
+			DstStringTable->SetSourceString(Key, SourceString);
+			bChanged = true;
+		}
+
+		//Later texts with the same string have to find the copied entry, like the exact lookup does
+		if (Context.Settings->bDedupNormalizedTexts)
+		{
+			Context.NormalizedIndex.FindOrAdd(NormalizeSourceString(SourceString), Key);
+		}
+	};
+
+	//Read the source string from the table, the text would give the string displayed for the current culture
+	FString SourceString;
+	FStringTableConstPtr SrcStringTable = FindSourceStringTable(SourceTableId, Context);
+	if (!SrcStringTable.IsValid() || !SrcStringTable->GetSourceString(Key, SourceString))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to find the key %s in the string table %s, the displayed string is copied instead"), *Key, *SourceTableId.ToString());
+		SetSourceString(Text.ToString());
+		return bChanged;
+	}
+
+	SetSourceString(SourceString);
+
+	//Keep the comments and other meta-data of the entry
+	SrcStringTable->EnumerateMetaData(Key, [&](FName MetaDataId, const FString& MetaData)
+	{
+		if (!DstStringTable->GetMetaData(Key, MetaDataId).Equals(MetaData, ESearchCase::CaseSensitive))
+		{
+			DstStringTable->SetMetaData(Key, MetaDataId, MetaData);
+			bChanged = true;
+		}
+		return true; // continue enumeration
+	});
+
+	return bChanged;
+}
+
 FString UStringTableGenerator::FindValueInStringTable(UStringTable* Table, const FString& Value)
 {
 	FString FoundKey = "";
@@ -377,13 +1227,76 @@ FString UStringTableGenerator::FindValueInStringTable(UStringTable* Table, const
 	return FoundKey;
 }
 
-FString UStringTableGenerator::CreateNewKeyName(const FString& RowName, UStringTable* DstStringtable, UStringTableGenerationSettings* Settings)
+FString UStringTableGenerator::NormalizeSourceString(const FString& Value)
+{
+	//Unify line endings so CRLF, CR and LF texts compare equal
+	FString Normalized = Value.Replace(TEXT("\r\n"), TEXT("\n"), ESearchCase::CaseSensitive);
+	Normalized.ReplaceCharInline(TEXT('\r'), TEXT('\n'), ESearchCase::CaseSensitive);
+
+	//Trailing whitespace is never meaningful for translation
+	Normalized.TrimEndInline();
+
+	return Normalized;
+}
+
+void UStringTableGenerator::BuildNormalizedSourceStringIndex(UStringTable* Table, TMap<FString, FString>& OutIndex)
+{
+	OutIndex.Reset();
+	Table->GetStringTable()->EnumerateSourceStrings([&](const FString& InKey, const FString& InSourceString)
+	{
+		//Keep the first key found for a given string, like FindValueInStringTable does
+		OutIndex.FindOrAdd(NormalizeSourceString(InSourceString), InKey);
+		return true; // continue enumeration
+	});
+}
+
+FString UStringTableGenerator::FindNormalizedValueInStringTable(UStringTable* Table, TMap<FString, FString>& NormalizedIndex, const FString& NormalizedValue)
+{
+	FString* FoundKey = NormalizedIndex.Find(NormalizedValue);
+	if (FoundKey == nullptr)
+	{
+		return "";
+	}
+
+	//The entry may have been overwritten since the index was built, make sure it still holds the same text
+	FString SourceString;
+	if (Table->GetStringTable()->GetSourceString(*FoundKey, SourceString) && NormalizeSourceString(SourceString) == NormalizedValue)
+	{
+		return *FoundKey;
+	}
+
+	//Another entry may still hold the text, look for the first one like FindValueInStringTable does
+	FString ScannedKey = "";
+	Table->GetStringTable()->EnumerateSourceStrings([&](const FString& InKey, const FString& InSourceString)
+	{
+		if (NormalizeSourceString(InSourceString) == NormalizedValue)
+		{
+			ScannedKey = InKey;
+			return false;
+		}
+
+		return true; // continue enumeration
+	});
+
+	if (ScannedKey.IsEmpty())
+	{
+		NormalizedIndex.Remove(NormalizedValue);
+	}
+	else
+	{
+		*FoundKey = ScannedKey;
+	}
+
+	return ScannedKey;
+}
+
+FString UStringTableGenerator::CreateNewKeyName(const FString& RowName, const FString& KeyPropertyName, UStringTable* DstStringtable, UStringTableGenerationSettings* Settings, int32& OutCollisionCount)
 {
 	FString Prefix = Settings->StringIdPrefix.IsEmpty() ? "" : Settings->StringIdPrefix + "_";
 	FString Suffix = Settings->StringIdSuffix.IsEmpty() ? "" : "_" + Settings->StringIdSuffix;
 	
 	TArray<FString> Parts;
-	Settings->PropertyName.ParseIntoArray(Parts, TEXT("."), true);
+	KeyPropertyName.ParseIntoArray(Parts, TEXT("."), true);
 	if (Parts.IsEmpty())
 	{
 		UE_LOG(LogTemp, Error, TEXT("Failed to parse Property name"));
@@ -399,13 +1312,14 @@ FString UStringTableGenerator::CreateNewKeyName(const FString& RowName, UStringT
 	while (DstStringtable->GetStringTable()->GetSourceString(Key, TempString))
 	{
 		Counter++;
+		OutCollisionCount++;
 		Key = Prefix + RowName + "_" + PropertyName + FString::FromInt(Counter) + Suffix;
 	}
 
 	return Key;
 }
 
-void UStringTableGenerator::RefreshStringTableEditor(UStringTable* StringTable)
+void UStringTableGenerator::RefreshStringTableEditor(UStringTable* StringTable, bool bStringTableModified)
 {
 	UAssetEditorSubsystem* AssetEditorSubSystem = GEditor ? GEditor->GetEditorSubsystem<UAssetEditorSubsystem>() : nullptr;
 	if (!AssetEditorSubSystem)
@@ -414,8 +1328,18 @@ void UStringTableGenerator::RefreshStringTableEditor(UStringTable* StringTable)
 		return;
 	}
 
-	//Close any opened editor
-	AssetEditorSubSystem->CloseAllEditorsForAsset(StringTable);
+	if (IAssetEditorInstance* OpenedEditor = AssetEditorSubSystem->FindEditorForAsset(StringTable, false))
+	{
+		//Nothing was added, the opened editor is still up to date so keep it as it is with its scroll position and selection
+		if (!bStringTableModified)
+		{
+			OpenedEditor->FocusWindow(StringTable);
+			return;
+		}
+
+		//The string table editor has no public way to refresh its list, it has to be rebuilt to show the new entries
+		AssetEditorSubSystem->CloseAllEditorsForAsset(StringTable);
+	}
 
 	//Open the editor
 	FStringTableEditorModule& StringTableEditorModule = FModuleManager::LoadModuleChecked<FStringTableEditorModule>("StringTableEditor");
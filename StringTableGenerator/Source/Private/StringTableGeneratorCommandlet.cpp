@@ -0,0 +1,114 @@
+#include "StringTableGeneratorCommandlet.h"
+#include "StringTableGenerator.h"
+#include "StringTableGenerationProfile.h"
+#include "AssetRegistry/ARFilter.h"
+#include "Internationalization/StringTable.h"
+
+UStringTableGeneratorCommandlet::UStringTableGeneratorCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UStringTableGeneratorCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	//Build the Asset Registry filter
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	Filter.bRecursiveClasses = true;
+
+	TArray<FString> Paths;
+	ParamsMap.FindRef(TEXT("Paths")).ParseIntoArray(Paths, TEXT("+"));
+	for (const FString& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName(Path));
+	}
+
+	TArray<FString> Classes;
+	ParamsMap.FindRef(TEXT("Classes")).ParseIntoArray(Classes, TEXT("+"));
+	for (const FString& Class : Classes)
+	{
+		Filter.ClassPaths.Add(FTopLevelAssetPath(Class));
+	}
+
+	if (Filter.PackagePaths.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("No package path given, use -Paths=/Game/MyFolder"));
+		return 1;
+	}
+
+	//Fill the settings from the profile first then from the command line
+	UStringTableGenerationSettings* Settings = NewObject<UStringTableGenerationSettings>();
+
+	if (const FString* ProfilePath = ParamsMap.Find(TEXT("Profile")))
+	{
+		UStringTableGenerationProfile* Profile = LoadObject<UStringTableGenerationProfile>(nullptr, **ProfilePath);
+		if (Profile == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load the generation profile %s"), **ProfilePath);
+			return 1;
+		}
+
+		Profile->ApplyTo(Settings);
+	}
+
+	if (const FString* NewStringTableName = ParamsMap.Find(TEXT("NewStringTable")))
+	{
+		Settings->bCreateNewStringTable = true;
+		Settings->NewStringTableName = *NewStringTableName;
+	}
+	else if (const FString* StringTablePath = ParamsMap.Find(TEXT("StringTable")))
+	{
+		Settings->bCreateNewStringTable = false;
+		Settings->ExistingStringTable = LoadObject<UStringTable>(nullptr, **StringTablePath);
+	}
+
+	if (const FString* PropertyName = ParamsMap.Find(TEXT("Property")))
+	{
+		Settings->bSaveAllProperties = false;
+		Settings->PropertyName = *PropertyName;
+	}
+	else if (Settings->Profile == nullptr)
+	{
+		Settings->bSaveAllProperties = true;
+	}
+
+	if (const FString* StringTableFolder = ParamsMap.Find(TEXT("Folder")))
+	{
+		Settings->StringTableFolder = *StringTableFolder;
+	}
+
+	if (const FString* Prefix = ParamsMap.Find(TEXT("Prefix")))
+	{
+		Settings->StringIdPrefix = *Prefix;
+	}
+
+	if (const FString* Suffix = ParamsMap.Find(TEXT("Suffix")))
+	{
+		Settings->StringIdSuffix = *Suffix;
+	}
+
+	Settings->bCopyAlreadyLocalizedKeys |= Switches.Contains(TEXT("CopyLocalizedKeys"));
+	Settings->bDedupNormalizedTexts |= Switches.Contains(TEXT("DedupNormalizedTexts"));
+	Settings->bBakeLookupTable |= Switches.Contains(TEXT("BakeLookupTable"));
+	Settings->bWriteGatherManifest |= Switches.Contains(TEXT("WriteGatherManifest"));
+
+	if (const FString* BatchSize = ParamsMap.Find(TEXT("BatchSize")))
+	{
+		Settings->AssetBatchSize = FCString::Atoi(**BatchSize);
+	}
+
+	if (!UStringTableGenerator::ValidateGenerationSettings(Settings))
+	{
+		return 1;
+	}
+
+	return UStringTableGenerator::GenerateStringTableContentForAssets(Filter, Settings) ? 0 : 1;
+}
@@ -0,0 +1,310 @@
+#include "StringTableReferenceGenerator.h"
+#include "StringTableGenerator.h"
+#include "Engine/DataTable.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+#include "Internationalization/StringTableRegistry.h"
+#include "UObject/PropertyOptional.h"
+
+namespace StringTableReferenceGenerator
+{
+	/** State shared by all the rows of a reference generation **/
+	struct FState
+	{
+		UStringTable* StringTable = nullptr;
+		UStringTableGenerationSettings* Settings = nullptr;
+		TMap<FString, FString> NormalizedIndex;
+		TMap<FName, FStringTableConstPtr> SourceStringTables;
+	};
+
+	static void GetPropertyAddresses(void* StartingObjects, const UStruct* DataStruct, FString PropertyPath, TMap<void*, FTextProperty*>& OutAddresses);
+
+	static void GetContainerItemAddresses(void* ItemAddress, FProperty* ItemProperty, const FString& RemainingPropertyPath, TMap<void*, FTextProperty*>& OutAddresses)
+	{
+		if (FTextProperty* ItemTextProperty = CastField<FTextProperty>(ItemProperty))
+		{
+			OutAddresses.Add(ItemAddress, ItemTextProperty);
+		}
+		else if (FStructProperty* ItemStructProperty = CastField<FStructProperty>(ItemProperty))
+		{
+			GetPropertyAddresses(ItemAddress, ItemStructProperty->Struct, RemainingPropertyPath, OutAddresses);
+		}
+	}
+
+	static void GetPropertyAddresses(void* StartingObjects, const UStruct* DataStruct, FString PropertyPath, TMap<void*, FTextProperty*>& OutAddresses)
+	{
+		TArray<FString> PropertyNames;
+		PropertyPath.ParseIntoArray(PropertyNames, TEXT("."));
+
+		const UStruct* CurrentStruct = DataStruct;
+		FProperty* CurrentProperty = nullptr;
+		void* CurrentAddress = StartingObjects;
+		FString CurrentPropertyPath = "";
+
+		for (FString PropertyName : PropertyNames)
+		{
+			CurrentProperty = CurrentStruct->FindPropertyByName(FName(PropertyName));
+			CurrentPropertyPath = CurrentPropertyPath.IsEmpty() ? PropertyName : CurrentPropertyPath + "." + PropertyName;
+
+			FString RemainingPropertyPath = PropertyPath.RightChop(CurrentPropertyPath.Len());
+			RemainingPropertyPath.RemoveFromStart(TEXT("."));
+
+			if (FTextProperty* TextProperty = CastField<FTextProperty>(CurrentProperty))
+			{
+				void* TextAddress = TextProperty->ContainerPtrToValuePtr<void>(CurrentAddress);
+				OutAddresses.Add(TextAddress, TextProperty);
+			}
+			else if (FStructProperty* StructProperty = CastField<FStructProperty>(CurrentProperty))
+			{
+				CurrentAddress = StructProperty->ContainerPtrToValuePtr<void>(CurrentAddress);
+				CurrentStruct = StructProperty->Struct;
+			}
+			else if (FArrayProperty* ArrayProperty = CastField<FArrayProperty>(CurrentProperty))
+			{
+				FScriptArrayHelper ArrayHelper(ArrayProperty, ArrayProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
+				for (int32 i = 0; i < ArrayHelper.Num(); ++i)
+				{
+					GetContainerItemAddresses(ArrayHelper.GetRawPtr(i), ArrayProperty->Inner, RemainingPropertyPath, OutAddresses);
+				}
+				break;
+			}
+			else if (FMapProperty* MapProperty = CastField<FMapProperty>(CurrentProperty))
+			{
+				FScriptMapHelper MapHelper(MapProperty, MapProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
+				for (int32 i = 0; i < MapHelper.GetMaxIndex(); ++i)
+				{
+					if (MapHelper.IsValidIndex(i))
+					{
+						GetContainerItemAddresses(MapHelper.GetValuePtr(i), MapProperty->ValueProp, RemainingPropertyPath, OutAddresses);
+					}
+				}
+				break;
+			}
+			else if (FSetProperty* SetProperty = CastField<FSetProperty>(CurrentProperty))
+			{
+				FScriptSetHelper SetHelper(SetProperty, SetProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
+				for (int32 i = 0; i < SetHelper.GetMaxIndex(); ++i)
+				{
+					if (SetHelper.IsValidIndex(i))
+					{
+						GetContainerItemAddresses(SetHelper.GetElementPtr(i), SetProperty->ElementProp, RemainingPropertyPath, OutAddresses);
+					}
+				}
+				break;
+			}
+			else if (FOptionalProperty* OptionalProperty = CastField<FOptionalProperty>(CurrentProperty))
+			{
+				void* ValueAddress = OptionalProperty->GetValuePointerForReadOrReplaceIfSet(OptionalProperty->ContainerPtrToValuePtr<void>(CurrentAddress));
+				if (ValueAddress != nullptr)
+				{
+					GetContainerItemAddresses(ValueAddress, OptionalProperty->GetValueProperty(), RemainingPropertyPath, OutAddresses);
+				}
+				break;
+			}
+		}
+	}
+
+	static void GetPropertiesToSave(void* Container, const UStruct* Struct, const TArray<FString>& PropertyPaths, TArray<FText*>& OutTextsToSave)
+	{
+		for (const FString& PropertyPath : PropertyPaths)
+		{
+			TMap<void*, FTextProperty*> PropertiesAddresses;
+			GetPropertyAddresses(Container, Struct, PropertyPath, PropertiesAddresses);
+
+			for (TPair<void*, FTextProperty*> PropertyAddress : PropertiesAddresses)
+			{
+				FText* Text = PropertyAddress.Value->GetPropertyValuePtr(PropertyAddress.Key);
+				if (Text != nullptr && !Text->IsEmpty())
+				{
+					OutTextsToSave.Add(Text);
+				}
+			}
+		}
+	}
+
+	static FString FindValueInStringTable(UStringTable* Table, const FString& Value)
+	{
+		FString FoundKey = "";
+		Table->GetStringTable()->EnumerateSourceStrings([&](const FString& InKey, const FString& InSourceString)
+		{
+			if (InSourceString == Value)
+			{
+				FoundKey = InKey;
+				return false;
+			}
+			return true;
+		});
+		return FoundKey;
+	}
+
+	static FString NormalizeSourceString(const FString& Value)
+	{
+		FString Normalized = Value.Replace(TEXT("\r\n"), TEXT("\n"), ESearchCase::CaseSensitive);
+		Normalized.ReplaceCharInline(TEXT('\r'), TEXT('\n'), ESearchCase::CaseSensitive);
+		Normalized.TrimEndInline();
+		return Normalized;
+	}
+
+	static FString FindNormalizedValueInStringTable(UStringTable* Table, const TMap<FString, FString>& NormalizedIndex, const FString& NormalizedValue)
+	{
+		const FString* FoundKey = NormalizedIndex.Find(NormalizedValue);
+		if (FoundKey == nullptr)
+		{
+			return "";
+		}
+
+		FString SourceString;
+		if (!Table->GetStringTable()->GetSourceString(*FoundKey, SourceString) || NormalizeSourceString(SourceString) != NormalizedValue)
+		{
+			return "";
+		}
+		return *FoundKey;
+	}
+
+	static void CopyStringTableEntry(FName SourceTableId, const FString& Key, const FText& Text, FState& State)
+	{
+		FStringTableRef DstStringTable = State.StringTable->GetMutableStringTable();
+
+		FStringTableConstPtr SrcStringTable;
+		if (const FStringTableConstPtr* CachedStringTable = State.SourceStringTables.Find(SourceTableId))
+		{
+			SrcStringTable = *CachedStringTable;
+		}
+		else
+		{
+			FName ResolvedTableId = SourceTableId;
+			IStringTableEngineBridge::FullyLoadStringTableAsset(ResolvedTableId);
+			SrcStringTable = State.SourceStringTables.Add(SourceTableId, FStringTableRegistry::Get().FindStringTable(ResolvedTableId));
+		}
+
+		FString SourceString;
+		if (!SrcStringTable.IsValid() || !SrcStringTable->GetSourceString(Key, SourceString))
+		{
+			DstStringTable->SetSourceString(Key, Text.ToString());
+			return;
+		}
+
+		DstStringTable->SetSourceString(Key, SourceString);
+		SrcStringTable->EnumerateMetaData(Key, [&](FName MetaDataId, const FString& MetaData)
+		{
+			DstStringTable->SetMetaData(Key, MetaDataId, MetaData);
+			return true;
+		});
+	}
+
+	static FString CreateNewKeyName(const FString& RowName, UStringTable* DstStringtable, UStringTableGenerationSettings* Settings)
+	{
+		FString Prefix = Settings->StringIdPrefix.IsEmpty() ? "" : Settings->StringIdPrefix + "_";
+		FString Suffix = Settings->StringIdSuffix.IsEmpty() ? "" : "_" + Settings->StringIdSuffix;
+
+		TArray<FString> Parts;
+		Settings->PropertyName.ParseIntoArray(Parts, TEXT("."), true);
+		if (Parts.IsEmpty())
+		{
+			return "";
+		}
+
+		FString PropertyName = Parts.Last();
+		FString Key = Prefix + RowName + "_" + PropertyName + Suffix;
+
+		FString TempString;
+		int32 Counter = 0;
+		while (DstStringtable->GetStringTable()->GetSourceString(Key, TempString))
+		{
+			Counter++;
+			Key = Prefix + RowName + "_" + PropertyName + FString::FromInt(Counter) + Suffix;
+		}
+		return Key;
+	}
+
+	static void GenerateEntriesForRow(void* Row, const UStruct* Struct, const FString& RowName, const TArray<FString>& PropertyPaths, FState& State)
+	{
+		UStringTable* StringTable = State.StringTable;
+		UStringTableGenerationSettings* Settings = State.Settings;
+
+		TArray<FText*> PropertiesToSave;
+		GetPropertiesToSave(Row, Struct, PropertyPaths, PropertiesToSave);
+
+		for (FText* Text : PropertiesToSave)
+		{
+			FString ExistingKey;
+			FName TableID;
+			if (FTextInspector::GetTableIdAndKey(*Text, TableID, ExistingKey))
+			{
+				if (!Settings->bCopyAlreadyLocalizedKeys || TableID == StringTable->GetStringTableId())
+				{
+					continue;
+				}
+
+				CopyStringTableEntry(TableID, ExistingKey, *Text, State);
+				*Text = FText::FromStringTable(StringTable->GetStringTableId(), ExistingKey);
+			}
+			else
+			{
+				FString Key;
+				FString NormalizedValue;
+				if (Settings->bDedupNormalizedTexts)
+				{
+					NormalizedValue = NormalizeSourceString(Text->ToString());
+					Key = FindNormalizedValueInStringTable(StringTable, State.NormalizedIndex, NormalizedValue);
+				}
+				else
+				{
+					Key = FindValueInStringTable(StringTable, Text->ToString());
+				}
+
+				if (Key.IsEmpty())
+				{
+					Key = CreateNewKeyName(RowName, StringTable, Settings);
+					StringTable->GetMutableStringTable()->SetSourceString(Key, Text->ToString());
+
+					if (Settings->bDedupNormalizedTexts)
+					{
+						State.NormalizedIndex.Add(NormalizedValue, Key);
+					}
+				}
+
+				*Text = FText::FromStringTable(StringTable->GetStringTableId(), Key);
+			}
+		}
+	}
+}
+
+void FStringTableReferenceGenerator::GenerateStringTableEntries(UStringTable* StringTable, UStringTableGenerationSettings* Settings)
+{
+	using namespace StringTableReferenceGenerator;
+
+	FState State;
+	State.StringTable = StringTable;
+	State.Settings = Settings;
+
+	if (Settings->bDedupNormalizedTexts)
+	{
+		StringTable->GetStringTable()->EnumerateSourceStrings([&](const FString& InKey, const FString& InSourceString)
+		{
+			State.NormalizedIndex.FindOrAdd(NormalizeSourceString(InSourceString), InKey);
+			return true;
+		});
+	}
+
+	TArray<FString> PropertyPaths = Settings->bSaveAllProperties ? Settings->AllPropertyNames : TArray<FString>{ Settings->PropertyName };
+	if (PropertyPaths.IsEmpty())
+	{
+		return;
+	}
+
+	UDataTable* DataTable = Settings->SourceDataTable;
+	const UScriptStruct* DtStruct = DataTable->GetRowStruct();
+	for (const FName& RowName : DataTable->GetRowNames())
+	{
+		if (FTableRowBase* TableRow = DataTable->FindRow<FTableRowBase>(RowName, TEXT("String Table Reference Generation")))
+		{
+			GenerateEntriesForRow(TableRow, DtStruct, RowName.ToString(), PropertyPaths, State);
+		}
+	}
+}
+
+void FStringTableReferenceGenerator::GetTexts(void* Container, const UStruct* Struct, const TArray<FString>& PropertyPaths, TArray<FText*>& OutTexts)
+{
+	StringTableReferenceGenerator::GetPropertiesToSave(Container, Struct, PropertyPaths, OutTexts);
+}
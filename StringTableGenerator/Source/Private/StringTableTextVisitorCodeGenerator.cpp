@@ -0,0 +1,199 @@
+#include "StringTableTextVisitorCodeGenerator.h"
+#include "StringTableGenerator.h"
+#include "Misc/FileHelper.h"
+#include "UObject/PropertyOptional.h"
+
+FString FStringTableTextVisitorCodeGenerator::GenerateCode(const TArray<const UScriptStruct*>& Structs)
+{
+	FString Includes;
+	FString Visitors;
+	for (const UScriptStruct* Struct : Structs)
+	{
+		if (!(Struct->StructFlags & STRUCT_Native))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s isn't a native struct, no visitor generated"), *Struct->GetPathName());
+			continue;
+		}
+
+		if (AppendStructVisitor(Struct, Visitors))
+		{
+			Includes += FString::Printf(TEXT("#include \"%s\"\n"), *GetIncludePath(Struct));
+		}
+	}
+
+	FString Code;
+	Code += TEXT("// Generated by the StringTableGenerator plugin, do not modify.\n");
+	Code += TEXT("// Include this file in a single .cpp file of an editor module depending on StringTableGenerator.\n\n");
+	Code += TEXT("#pragma once\n\n");
+	Code += TEXT("#if WITH_EDITOR\n\n");
+	Code += TEXT("#include \"StringTableTextVisitorRegistry.h\"\n");
+	Code += Includes;
+	Code += TEXT("\n");
+	Code += Visitors;
+	Code += TEXT("#endif\n");
+	return Code;
+}
+
+bool FStringTableTextVisitorCodeGenerator::WriteFile(const TArray<const UScriptStruct*>& Structs, const FString& FilePath)
+{
+	return FFileHelper::SaveStringToFile(GenerateCode(Structs), *FilePath);
+}
+
+bool FStringTableTextVisitorCodeGenerator::AppendStructVisitor(const UScriptStruct* Struct, FString& OutCode)
+{
+	const FString StructName = Struct->GetStructCPPName();
+
+	TArray<FString> PropertyPaths;
+	UStringTableGenerator::GetAllTextPropertiesRecursive(Struct, "", PropertyPaths);
+
+	//One function per property path, looked up once by the registry instead of comparing the path on every call
+	//The paths that can't be reached are left to the reflection
+	FString Functions;
+	FString Registrations;
+	int32 FunctionCount = 0;
+	for (const FString& PropertyPath : PropertyPaths)
+	{
+		TArray<FString> PathParts;
+		PropertyPath.ParseIntoArray(PathParts, TEXT("."));
+
+		FString Visit;
+		if (!AppendPropertyPathVisit(Struct, TEXT("Row"), PathParts, 0, TEXT("\t\t"), Visit))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s.%s isn't accessible from C++, the reflection is used for it"), *StructName, *PropertyPath);
+			continue;
+		}
+
+		//Numbered names, the property paths could collide once their dots are replaced
+		const FString FunctionName = FString::Printf(TEXT("VisitPath%d"), FunctionCount++);
+		Functions += FString::Printf(TEXT("\t// %s\n"), *PropertyPath);
+		Functions += FString::Printf(TEXT("\tstatic void %s(void* Container, TArray<FText*>& OutTexts)\n\t{\n"), *FunctionName);
+		Functions += FString::Printf(TEXT("\t\t%s& Row = *static_cast<%s*>(Container);\n"), *StructName, *StructName);
+		Functions += Visit;
+		Functions += TEXT("\t}\n\n");
+
+		Registrations += FString::Printf(TEXT("\t\tRegistry.Register(%s::StaticStruct(), TEXT(\"%s\"), &%s);\n"), *StructName, *PropertyPath, *FunctionName);
+	}
+
+	if (Functions.IsEmpty())
+	{
+		return false;
+	}
+
+	OutCode += TEXT("template<>\n");
+	OutCode += FString::Printf(TEXT("struct TStringTableTextVisitor<%s>\n{\n"), *StructName);
+	OutCode += Functions;
+	OutCode += TEXT("\tstatic void Register(FStringTableTextVisitorRegistry& Registry)\n\t{\n");
+	OutCode += Registrations;
+	OutCode += TEXT("\t}\n};\n\n");
+	OutCode += FString::Printf(TEXT("REGISTER_STRINGTABLE_TEXT_VISITOR(%s)\n\n"), *StructName);
+	return true;
+}
+
+bool FStringTableTextVisitorCodeGenerator::AppendPropertyPathVisit(const UStruct* Struct, const FString& Access, TArrayView<const FString> PathParts, int32 Depth, const FString& Indent, FString& OutCode)
+{
+	if (PathParts.IsEmpty())
+	{
+		return false;
+	}
+
+	//Private and protected members can't be reached by the generated code
+	FProperty* Property = Struct->FindPropertyByName(FName(PathParts[0]));
+	if (Property == nullptr || Property->HasAnyPropertyFlags(CPF_NativeAccessSpecifierPrivate | CPF_NativeAccessSpecifierProtected))
+	{
+		return false;
+	}
+
+	//C-style array members can't be accessed like a single value, they are left to the reflection
+	if (Property->ArrayDim > 1)
+	{
+		return false;
+	}
+
+	const FString MemberAccess = Access + TEXT(".") + Property->GetName();
+	TArrayView<const FString> RemainingParts = PathParts.RightChop(1);
+
+	//It's a text, add it directly
+	if (CastField<FTextProperty>(Property))
+	{
+		if (!RemainingParts.IsEmpty())
+		{
+			return false;
+		}
+
+		OutCode += FString::Printf(TEXT("%sStringTableTextVisitor::AddText(%s, OutTexts);\n"), *Indent, *MemberAccess);
+		return true;
+	}
+
+	//It's a struct, continue the path inside of it
+	if (FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		return AppendPropertyPathVisit(StructProperty->Struct, MemberAccess, RemainingParts, Depth, Indent, OutCode);
+	}
+
+	//It's a container, loop over its items in the same order as the script helpers do
+	FString ItemName = FString::Printf(TEXT("Item%d"), Depth);
+	FString LoopStatement;
+	FString ItemAccess;
+	if (Property->IsA<FArrayProperty>() || Property->IsA<FSetProperty>())
+	{
+		LoopStatement = FString::Printf(TEXT("for (auto& %s : %s)"), *ItemName, *MemberAccess);
+		ItemAccess = ItemName;
+	}
+	else if (Property->IsA<FMapProperty>())
+	{
+		LoopStatement = FString::Printf(TEXT("for (auto& %s : %s)"), *ItemName, *MemberAccess);
+		ItemAccess = ItemName + TEXT(".Value");
+	}
+	else if (Property->IsA<FOptionalProperty>())
+	{
+		LoopStatement = FString::Printf(TEXT("if (%s.IsSet())"), *MemberAccess);
+		ItemAccess = MemberAccess + TEXT(".GetValue()");
+	}
+	else
+	{
+		return false;
+	}
+
+	FProperty* ItemProperty = UStringTableGenerator::GetContainerItemProperty(Property);
+	const FString ItemIndent = Indent + TEXT("\t");
+
+	FString Body;
+	if (CastField<FTextProperty>(ItemProperty))
+	{
+		if (!RemainingParts.IsEmpty())
+		{
+			return false;
+		}
+
+		Body = FString::Printf(TEXT("%sStringTableTextVisitor::AddText(%s, OutTexts);\n"), *ItemIndent, *ItemAccess);
+	}
+	else if (FStructProperty* ItemStructProperty = CastField<FStructProperty>(ItemProperty))
+	{
+		if (!AppendPropertyPathVisit(ItemStructProperty->Struct, ItemAccess, RemainingParts, Depth + 1, ItemIndent, Body))
+		{
+			return false;
+		}
+	}
+	else
+	{
+		return false;
+	}
+
+	OutCode += FString::Printf(TEXT("%s%s\n%s{\n%s%s}\n"), *Indent, *LoopStatement, *Indent, *Body, *Indent);
+	return true;
+}
+
+FString FStringTableTextVisitorCodeGenerator::GetIncludePath(const UScriptStruct* Struct)
+{
+	//The path is relative to the module, remove the include directory to get the path used in the includes
+	FString IncludePath = Struct->GetMetaData(TEXT("ModuleRelativePath"));
+	for (const TCHAR* IncludeDirectory : { TEXT("Public/"), TEXT("Classes/"), TEXT("Private/") })
+	{
+		if (IncludePath.RemoveFromStart(IncludeDirectory))
+		{
+			break;
+		}
+	}
+
+	return IncludePath;
+}
@@ -0,0 +1,136 @@
+#include "StringTableTextVisitorCommandlet.h"
+#include "StringTableGenerator.h"
+#include "StringTableTextVisitorCodeGenerator.h"
+#include "StringTableTextVisitorRegistry.h"
+#include "Engine/DataTable.h"
+
+UStringTableTextVisitorCommandlet::UStringTableTextVisitorCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UStringTableTextVisitorCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamsMap;
+	ParseCommandLine(*Params, Tokens, Switches, ParamsMap);
+
+	if (Switches.Contains(TEXT("Benchmark")))
+	{
+		UDataTable* DataTable = LoadObject<UDataTable>(nullptr, *ParamsMap.FindRef(TEXT("DataTable")));
+		if (DataTable == nullptr)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to load the DataTable, use -DataTable=/Game/MyDataTable.MyDataTable"));
+			return 1;
+		}
+
+		const FString* Iterations = ParamsMap.Find(TEXT("Iterations"));
+		return RunBenchmark(DataTable, Iterations ? FMath::Max(1, FCString::Atoi(**Iterations)) : 100);
+	}
+
+	//Find the structs to write the visitors for
+	TArray<FString> StructPaths;
+	ParamsMap.FindRef(TEXT("Structs")).ParseIntoArray(StructPaths, TEXT("+"));
+
+	TArray<const UScriptStruct*> Structs;
+	for (const FString& StructPath : StructPaths)
+	{
+		if (const UScriptStruct* Struct = FindObject<UScriptStruct>(nullptr, *StructPath))
+		{
+			Structs.Add(Struct);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to find the struct %s"), *StructPath);
+			return 1;
+		}
+	}
+
+	const FString OutputPath = ParamsMap.FindRef(TEXT("Output"));
+	if (Structs.IsEmpty() || OutputPath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Use -Structs=/Script/MyGame.MyRow -Output=Path/To/MyTextVisitors.h"));
+		return 1;
+	}
+
+	if (!FStringTableTextVisitorCodeGenerator::WriteFile(Structs, OutputPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write %s"), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Text visitors written to %s"), *OutputPath);
+	return 0;
+}
+
+int32 UStringTableTextVisitorCommandlet::RunBenchmark(UDataTable* DataTable, int32 Iterations)
+{
+	const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+	if (!FStringTableTextVisitorRegistry::Get().HasVisitors(RowStruct))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No compiled visitor registered for %s, both runs use the reflection"), *RowStruct->GetName());
+	}
+
+	TArray<FString> PropertyPaths;
+	UStringTableGenerator::GetAllTextPropertiesRecursive(RowStruct, "", PropertyPaths);
+
+	TArray<uint8*> Rows;
+	DataTable->GetRowMap().GenerateValueArray(Rows);
+
+	//Collect the texts of all the rows once, with or without the compiled visitors
+	auto CollectTexts = [&](bool bUseVisitors, TArray<FText*>& OutTexts)
+	{
+		FStringTableTextVisitorRegistry::Get().SetEnabled(bUseVisitors);
+
+		const double StartTime = FPlatformTime::Seconds();
+		OutTexts.Reset();
+		for (uint8* Row : Rows)
+		{
+			UStringTableGenerator::GetPropertiesToSave(Row, RowStruct, PropertyPaths, OutTexts);
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartTime;
+
+		FStringTableTextVisitorRegistry::Get().SetEnabled(true);
+		return Seconds;
+	};
+
+	//Warm up both ways so the first one measured doesn't pay for the cold caches
+	TArray<FText*> VisitorTexts;
+	TArray<FText*> ReflectionTexts;
+	CollectTexts(true, VisitorTexts);
+	CollectTexts(false, ReflectionTexts);
+
+	//Alternate which way runs first so neither always benefits from the caches warmed by the other
+	double VisitorSeconds = 0.0;
+	double ReflectionSeconds = 0.0;
+	for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+	{
+		if (Iteration % 2 == 0)
+		{
+			VisitorSeconds += CollectTexts(true, VisitorTexts);
+			ReflectionSeconds += CollectTexts(false, ReflectionTexts);
+		}
+		else
+		{
+			ReflectionSeconds += CollectTexts(false, ReflectionTexts);
+			VisitorSeconds += CollectTexts(true, VisitorTexts);
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("%d rows, %d texts, %d iterations"), Rows.Num(), ReflectionTexts.Num(), Iterations);
+	UE_LOG(LogTemp, Display, TEXT("Compiled visitors: %.3f ms per iteration"), VisitorSeconds * 1000.0 / Iterations);
+	UE_LOG(LogTemp, Display, TEXT("Reflection:        %.3f ms per iteration (%.2fx)"), ReflectionSeconds * 1000.0 / Iterations, VisitorSeconds > 0.0 ? ReflectionSeconds / VisitorSeconds : 0.0);
+
+	//Both ways have to find the same texts in the same order, the generated keys depend on it
+	if (VisitorTexts != ReflectionTexts)
+	{
+		UE_LOG(LogTemp, Error, TEXT("The compiled visitors and the reflection don't find the same texts, regenerate the visitors"));
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,34 @@
+#include "StringTableTextVisitorRegistry.h"
+
+FStringTableTextVisitorRegistry& FStringTableTextVisitorRegistry::Get()
+{
+	static FStringTableTextVisitorRegistry Registry;
+	return Registry;
+}
+
+void FStringTableTextVisitorRegistry::Register(const UStruct* Struct, const FString& PropertyPath, FStringTableTextVisitorFunc Visitor)
+{
+	Visitors.FindOrAdd(Struct).Add(PropertyPath, Visitor);
+}
+
+FStringTableTextVisitorFunc FStringTableTextVisitorRegistry::Find(const UStruct* Struct, const FString& PropertyPath) const
+{
+	if (!bEnabled)
+	{
+		return nullptr;
+	}
+
+	const TMap<FString, FStringTableTextVisitorFunc>* StructVisitors = Visitors.Find(Struct);
+	const FStringTableTextVisitorFunc* Visitor = StructVisitors ? StructVisitors->Find(PropertyPath) : nullptr;
+	return Visitor ? *Visitor : nullptr;
+}
+
+bool FStringTableTextVisitorRegistry::HasVisitors(const UStruct* Struct) const
+{
+	return Visitors.Contains(Struct);
+}
+
+void FStringTableTextVisitorRegistry::SetEnabled(bool bInEnabled)
+{
+	bEnabled = bInEnabled;
+}
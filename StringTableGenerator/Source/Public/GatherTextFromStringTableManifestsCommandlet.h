@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/GatherTextCommandletBase.h"
+
+#include "GatherTextFromStringTableManifestsCommandlet.generated.h"
+
+/**
+ * Localization gather step adding the string table entries and the other texts listed in the gather manifests written by the string table generation
+ * 
+ * Usage, in the gather config of a localization target:
+ * [GatherTextStep1]
+ * CommandletClass=GatherTextFromStringTableManifests
+ * ManifestDirectory=%LOCPROJECTROOT%Config/StringTableGenerator/GatherManifests (optional)
+ * 
+ * The DataTables handled by the generation can then be excluded from the GatherTextFromAssets step
+ */
+UCLASS()
+class UGatherTextFromStringTableManifestsCommandlet : public UGatherTextCommandletBase
+{
+	GENERATED_BODY()
+
+public:
+	/** UCommandlet implementation */
+	virtual int32 Main(const FString& Params) override;
+};
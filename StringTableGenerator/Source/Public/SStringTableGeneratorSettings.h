@@ -40,6 +40,12 @@ private:
 	/** Close the window */
 	FReply OnCancelButtonClicked();
 
+	/** Called when another profile is selected, loads its configuration into the settings **/
+	void OnProfileChanged();
+
+	/** Select the given property name in the combo box, or the first one if it isn't found **/
+	void SelectPropertyName(const FString& InPropertyName);
+
 	/** Called when we select another Property Name **/
 	void OnPropertyNameSelectionChanged(TSharedPtr<FString> SelectedName, ESelectInfo::Type SelectionType);
 
@@ -54,9 +60,6 @@ private:
 	/** Get the currently selected property name **/
 	FText GetPropertyNameComboBoxContent() const;
 
-	/** Retrieve all the text properties from the current DataTable struct **/
-	void GetAllTextPropertiesRecursive(const UScriptStruct* Struct, FString PropertyPath, TArray<FString>& OutTextProperties) const;
-
 	/** The Popup window this widget is in */
 	TSharedPtr<SWindow> ParentWindow;
 
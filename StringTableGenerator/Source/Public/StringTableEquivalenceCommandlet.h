@@ -0,0 +1,93 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "Engine/DataTable.h"
+
+#include "StringTableEquivalenceCommandlet.generated.h"
+
+class UStringTable;
+class UStringTableGenerationSettings;
+
+/**
+ * Nested item of the randomized rows of the equivalence commandlet
+ */
+USTRUCT()
+struct FStringTableEquivalenceChoice
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FText Label;
+
+	UPROPERTY()
+	FText Tooltip;
+};
+
+/**
+ * Row struct of the randomized DataTables of the equivalence commandlet, covers plain texts, arrays, nested structs and maps
+ */
+USTRUCT()
+struct FStringTableEquivalenceRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FText Name;
+
+	UPROPERTY()
+	FText Description;
+
+	UPROPERTY()
+	TArray<FText> Lines;
+
+	UPROPERTY()
+	TArray<FStringTableEquivalenceChoice> Choices;
+
+	UPROPERTY()
+	TMap<FName, FText> Tags;
+};
+
+/**
+ * Commandlet to check that the generation produces the same string table entries and links as the frozen reference generation (FStringTableReferenceGenerator)
+ * 
+ * Usage: -run=StringTableEquivalence [-DataTables=/Game/Data/DT_A.DT_A+/Game/Data/DT_B.DT_B] [-RandomTables=4] [-RandomRows=1000] [-Seed=0] [-Iterations=1]
+ *		  [-StringTable=/Game/StringTables/ST_Data.ST_Data] [-Profile=/Game/MyProfile.MyProfile] [-Property=Name] [-Prefix=] [-Suffix=] [-CopyLocalizedKeys] [-DedupNormalizedTexts]
+ * 
+ * Both generations run on their own copy of each DataTable and of the string table, the source assets are never modified
+ * Without -DataTables, a single randomized DataTable is checked
+ * Returns 1 if any entry or text differs, except for the intended changes listed in FStringTableReferenceGenerator
+ */
+UCLASS()
+class UStringTableEquivalenceCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStringTableEquivalenceCommandlet();
+
+	/** UCommandlet implementation */
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Run both generations on the DataTable, log the timings side by side and return the number of differences **/
+	int32 CheckEquivalence(UDataTable* DataTable, UStringTableGenerationSettings* Settings, UStringTable* InitialStringTable, int32 Iterations);
+
+	/** Compare the entries of both string tables, returns the number of differences **/
+	int32 DiffStringTables(UStringTable* ReferenceTable, UStringTable* OptimizedTable);
+
+	/** Compare the texts of both DataTables row by row, returns the number of differences **/
+	int32 DiffLinkedTexts(UDataTable* ReferenceDataTable, UStringTable* ReferenceTable, UDataTable* OptimizedDataTable, UStringTable* OptimizedTable, const TArray<FString>& PropertyPaths);
+
+	/** Create a transient DataTable of FStringTableEquivalenceRow with texts picked to trigger dedup hits and key collisions **/
+	static UDataTable* CreateRandomDataTable(int32 RowCount, int32 Seed);
+
+	/** Log a difference, only the first ones are logged to keep the output readable **/
+	void ReportDifference(const FString& Message);
+
+	/** Number of differences logged for the current DataTable **/
+	int32 ReportedDifferenceCount = 0;
+
+	/** Are the differences of the current DataTable caused by an intended change of the generation, they are then logged as warnings and not counted **/
+	bool bDifferencesExpected = false;
+};
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "StringTableGatherManifest.generated.h"
+
+class UStringTable;
+
+/**
+ * A text linked to a string table entry by the generation
+ */
+USTRUCT()
+struct STRINGTABLEGENERATOR_API FStringTableGatherManifestEntry
+{
+	GENERATED_BODY()
+
+	/** Key of the string table entry **/
+	UPROPERTY()
+	FString Key;
+
+	/** Source string of the string table entry **/
+	UPROPERTY()
+	FString SourceString;
+
+	/** Path of the DataTable or asset holding the text **/
+	UPROPERTY()
+	FString SourceAsset;
+
+	/** Name of the DataTable row, or of the asset for the other assets **/
+	UPROPERTY()
+	FString Row;
+
+	/** Path of the text property in the row or asset **/
+	UPROPERTY()
+	FString PropertyPath;
+};
+
+/**
+ * A localizable text of a generated asset that isn't linked to any string table
+ */
+USTRUCT()
+struct STRINGTABLEGENERATOR_API FStringTableGatherManifestText
+{
+	GENERATED_BODY()
+
+	/** Localization namespace of the text **/
+	UPROPERTY()
+	FString Namespace;
+
+	/** Localization key of the text **/
+	UPROPERTY()
+	FString Key;
+
+	/** Source string of the text **/
+	UPROPERTY()
+	FString SourceString;
+
+	/** Path of the DataTable or asset holding the text **/
+	UPROPERTY()
+	FString SourceAsset;
+
+	/** Name of the DataTable row, or of the asset for the other assets **/
+	UPROPERTY()
+	FString Row;
+
+	/** Path of the text property in the row or asset **/
+	UPROPERTY()
+	FString PropertyPath;
+};
+
+/**
+ * Every localizable text of the assets processed by the generations of a string table, used by the localization gather instead of scanning the assets again
+ * Texts linked to other string tables are left out, they are gathered with their own table
+ */
+USTRUCT()
+struct STRINGTABLEGENERATOR_API FStringTableGatherManifest
+{
+	GENERATED_BODY()
+
+	/** Path of the string table asset **/
+	UPROPERTY()
+	FString StringTable;
+
+	/** Id of the string table, used by the texts linked to it **/
+	UPROPERTY()
+	FString TableId;
+
+	/** Localization namespace of the string table entries **/
+	UPROPERTY()
+	FString Namespace;
+
+	/** The texts linked to the string table, sorted by asset, row and property path **/
+	UPROPERTY()
+	TArray<FStringTableGatherManifestEntry> Entries;
+
+	/** The texts not linked to any string table, sorted by asset, row and property path **/
+	UPROPERTY()
+	TArray<FStringTableGatherManifestText> Texts;
+};
+
+/**
+ * Gather manifests of the string tables, stored as one JSON file per string table under Config/StringTableGenerator/GatherManifests
+ * They are shared through source control like the gather configs, so every machine running the gather gets them
+ */
+class STRINGTABLEGENERATOR_API FStringTableGatherManifests
+{
+public:
+	/** Folder holding the manifests **/
+	static FString GetManifestDirectory();
+
+	/** Path of the manifest of the given string table **/
+	static FString GetManifestFilePath(const UStringTable* StringTable);
+
+	/** Read a manifest file **/
+	static bool LoadManifest(const FString& Filename, FStringTableGatherManifest& OutManifest);
+
+	/** Replace the entries and texts of the given assets in the manifest of the string table, the source strings of the entries are read from the string table
+	*	@ProcessedAssets: Paths of the assets processed by the generation, their previous entries and texts are removed
+	*	@NewEntries: The texts of these assets linked to the string table
+	*	@NewTexts: The localizable texts of these assets not linked to any string table
+	**/
+	static bool UpdateManifest(const UStringTable* StringTable, const TSet<FString>& ProcessedAssets, TArray<FStringTableGatherManifestEntry>&& NewEntries, TArray<FStringTableGatherManifestText>&& NewTexts);
+};
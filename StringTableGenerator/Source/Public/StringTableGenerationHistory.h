@@ -0,0 +1,106 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "StringTableGenerationHistory.generated.h"
+
+/**
+ * Metrics of a single string table generation, appended to the generation history
+ */
+USTRUCT()
+struct STRINGTABLEGENERATOR_API FStringTableGenerationRecord
+{
+	GENERATED_BODY()
+
+	/** When the generation ended, in ISO 8601 format **/
+	UPROPERTY()
+	FString Date;
+
+	/** Path of the string table receiving the entries **/
+	UPROPERTY()
+	FString StringTable;
+
+	/** Path of the DataTable the texts come from, or the Asset Registry filter used **/
+	UPROPERTY()
+	FString Source;
+
+	/** Number of DataTable rows and assets processed **/
+	UPROPERTY()
+	int32 RowCount = 0;
+
+	/** Number of texts processed **/
+	UPROPERTY()
+	int32 TextCount = 0;
+
+	/** Number of texts linked to an entry that already had the same source string **/
+	UPROPERTY()
+	int32 DedupHitCount = 0;
+
+	/** Number of entries created with a new key **/
+	UPROPERTY()
+	int32 NewKeyCount = 0;
+
+	/** Number of entries copied from other string tables **/
+	UPROPERTY()
+	int32 CopiedKeyCount = 0;
+
+	/** Number of generated key names that were already used and had to be incremented **/
+	UPROPERTY()
+	int32 CollisionProbeCount = 0;
+
+	/** Time spent to create or load the string table **/
+	UPROPERTY()
+	double ResolveSeconds = 0.0;
+
+	/** Time spent to load the assets, only for Asset Registry generations **/
+	UPROPERTY()
+	double LoadSeconds = 0.0;
+
+	/** Time spent to generate the entries and link the texts **/
+	UPROPERTY()
+	double GenerateSeconds = 0.0;
+
+	/** Time spent to save the packages or refresh the editor **/
+	UPROPERTY()
+	double FinalizeSeconds = 0.0;
+
+	/** Total time of the generation **/
+	UPROPERTY()
+	double TotalSeconds = 0.0;
+
+	/** Physical memory used by the process at the end of the generation minus the memory used at its start **/
+	UPROPERTY()
+	int64 UsedPhysicalDeltaBytes = 0;
+
+	/** Highest physical memory used by the process during the generation minus the memory used at its start, sampled after each phase or batch **/
+	UPROPERTY()
+	int64 PeakUsedPhysicalDeltaBytes = 0;
+
+	/** Ratio of the texts linked to an existing entry among the texts that needed an entry **/
+	double GetDedupHitRate() const;
+
+	/** Average generation time of a row, used to compare runs of different sizes **/
+	double GetSecondsPerRow() const;
+};
+
+/**
+ * Local history of the string table generations, stored as one JSON record per line under Saved/StringTableGenerator
+ */
+class STRINGTABLEGENERATOR_API FStringTableGenerationHistory
+{
+public:
+	/** Path of the history file **/
+	static FString GetHistoryFilePath();
+
+	/** Add the record of a generation at the end of the history file **/
+	static void AppendRecord(const FStringTableGenerationRecord& Record);
+
+	/** Read all the records of the history file, oldest first **/
+	static void LoadRecords(TArray<FStringTableGenerationRecord>& OutRecords);
+
+	/** Log the trend of the generation cost for each source and return the indices of the runs slower per row than their rolling baseline
+	*	@BaselineRunCount: Number of previous runs of the same source averaged into the baseline
+	*	@SlowdownThreshold: Ratio to the baseline above which a run is flagged
+	**/
+	static TArray<int32> ReportTrends(const TArray<FStringTableGenerationRecord>& Records, int32 BaselineRunCount, double SlowdownThreshold);
+};
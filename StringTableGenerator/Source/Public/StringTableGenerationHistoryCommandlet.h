@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "StringTableGenerationHistoryCommandlet.generated.h"
+
+/**
+ * Commandlet to print the trend of the string table generation cost from the generation history
+ * 
+ * Usage: -run=StringTableGenerationHistory [-Baseline=10] [-Threshold=1.5]
+ * 
+ * A run is flagged when its time per row is more than Threshold times the average of the Baseline previous runs of the same source
+ * Returns 1 if the most recent run is flagged
+ */
+UCLASS()
+class UStringTableGenerationHistoryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStringTableGenerationHistoryCommandlet();
+
+	/** UCommandlet implementation */
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/ObjectKey.h"
+
+#include "StringTableGenerationProfile.generated.h"
+
+class UStringTable;
+class UStringTableGenerationSettings;
+
+/**
+ * Saved configuration of a string table generation, shared by the DataTable editor toolbar and the commandlet
+ * Keeps what was resolved during the previous runs so the next ones against the same table skip the setup, this cache is only kept in memory for the current editor session
+ */
+UCLASS(BlueprintType)
+class STRINGTABLEGENERATOR_API UStringTableGenerationProfile : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Copy the configuration of this profile into the given generation settings **/
+	void ApplyTo(UStringTableGenerationSettings* Settings) const;
+
+	/** Returns the string table resolved by a previous run if it is still the one targeted by the given settings **/
+	UStringTable* GetResolvedStringTable(const UStringTableGenerationSettings* Settings) const;
+
+	/** Remember the string table used by the last run **/
+	void SetResolvedStringTable(UStringTable* StringTable);
+
+	/** Returns the text property paths found for the given struct or class by a previous run, or nullptr **/
+	const TArray<FString>* FindResolvedTextPropertyPaths(const UStruct* Struct) const;
+
+	/** Remember the text property paths of the given struct or class for the next runs **/
+	void SetResolvedTextPropertyPaths(const UStruct* Struct, const TArray<FString>& PropertyPaths);
+
+	/** Should we save all the text properties or only PropertyName **/
+	UPROPERTY(EditAnywhere, Category = "Properties")
+	bool bSaveAllProperties = false;
+
+	/** The Property we want to save into the string table, used only if bSaveAllProperties is false **/
+	UPROPERTY(EditAnywhere, Category = "Properties", meta = (EditCondition = "!bSaveAllProperties"))
+	FString PropertyName;
+
+	/** Should copy the string table keys of the texts that are already localized into the current string table **/
+	UPROPERTY(EditAnywhere, Category = "Properties")
+	bool bCopyAlreadyLocalizedKeys = false;
+
+	/** Should texts that only differ by line endings or trailing whitespace share the same string table entry **/
+	UPROPERTY(EditAnywhere, Category = "Properties")
+	bool bDedupNormalizedTexts = false;
+
+	/** Should we create a new string table **/
+	UPROPERTY(EditAnywhere, Category = "String Table")
+	bool bCreateNewStringTable = false;
+
+	/** The folder in which the new string table is created **/
+	UPROPERTY(EditAnywhere, Category = "String Table", meta = (EditCondition = "bCreateNewStringTable", ContentDir))
+	FString StringTableFolder = TEXT("/Game/CrisisUnit/StringTables");
+
+	/** The name of the new string table, used only if bCreateNewStringTable is true **/
+	UPROPERTY(EditAnywhere, Category = "String Table", meta = (EditCondition = "bCreateNewStringTable"))
+	FString NewStringTableName;
+
+	/** The existing string table to use, used only if bCreateNewStringTable is false **/
+	UPROPERTY(EditAnywhere, Category = "String Table", meta = (EditCondition = "!bCreateNewStringTable"))
+	TSoftObjectPtr<UStringTable> ExistingStringTable;
+
+	/** The prefix to add to the new string table keys **/
+	UPROPERTY(EditAnywhere, Category = "Keys")
+	FString StringIdPrefix;
+
+	/** The suffix to add to the new string table keys **/
+	UPROPERTY(EditAnywhere, Category = "Keys")
+	FString StringIdSuffix;
+
+	/** Should the DataTable and the string table be saved at the end of the generation **/
+	UPROPERTY(EditAnywhere, Category = "Properties")
+	bool bSaveModifiedPackages = false;
+
+	/** Should a baked lookup (StringTableLookup asset) be kept next to the string table for fast runtime lookups **/
+	UPROPERTY(EditAnywhere, Category = "String Table")
+	bool bBakeLookupTable = false;
+
+	/** Should the texts of the processed assets be written to the gather manifest of the string table, the modified packages are then always saved **/
+	UPROPERTY(EditAnywhere, Category = "String Table")
+	bool bWriteGatherManifest = false;
+
+	/** Number of assets loaded, processed and saved together when generating from the Asset Registry **/
+	UPROPERTY(EditAnywhere, Category = "Assets", meta = (ClampMin = 1))
+	int32 AssetBatchSize = 64;
+
+private:
+	/** The string table used by the last run, only reused while the configuration still points to it **/
+	UPROPERTY(Transient)
+	TObjectPtr<UStringTable> ResolvedStringTable;
+
+	/** The text property paths of the native structs and classes met by the previous runs **/
+	TMap<FObjectKey, TArray<FString>> ResolvedTextPropertyPaths;
+};
@@ -1,10 +1,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Internationalization/StringTableCoreFwd.h"
 
 #include "StringTableGenerator.generated.h"
 
 class UDataTable;
+class UStringTableGenerationProfile;
+class UStringTableLookup;
+struct FARFilter;
+struct FStringTableGenerationContext;
 
 /**
  * Generator to add rows into a String Table based on a DataTable's data
@@ -21,37 +26,123 @@ public:
 	/** Main function to generate the content of a string table based on the Text properties of a DataTable **/
 	static void GenerateStringTableContent(UStringTableGenerationSettings* Settings);
 
+	/** Generate the content of a string table based on the Text properties of every asset matching the filter (DataTables, DataAssets, Blueprint default objects...)
+	*	The assets are loaded and saved by batches of AssetBatchSize to keep the memory bounded
+	*	Returns false if any package failed to save
+	**/
+	static bool GenerateStringTableContentForAssets(const FARFilter& Filter, UStringTableGenerationSettings* Settings);
+
+	/** Generate the entries of the settings DataTable into the given string table and link its texts, without saving, refreshing the editor or recording the generation **/
+	static void GenerateStringTableEntries(UStringTable* StringTable, UStringTableGenerationSettings* Settings);
+
 	/** Make sure the generation settings are correct before strating the generation **/
 	static bool ValidateGenerationSettings(UStringTableGenerationSettings* Settings);
 
+	/** Retrieve all the text properties of the given struct or class **/
+	static void GetAllTextPropertiesRecursive(const UStruct* Struct, FString PropertyPath, TArray<FString>& OutTextProperties);
+
+	/** Returns the property of the items stored in the given container property (array, map, set or optional) or nullptr if it's not a container **/
+	static FProperty* GetContainerItemProperty(FProperty* ContainerProperty);
+
+	/** Returns the list of properties that need to be saved for the given row or object, through its compiled visitor when it has one
+	*	@OutTextPropertyPaths: When given, receives the property path of each text, pointing into PropertyPaths
+	**/
+	static void GetPropertiesToSave(void* Container, const UStruct* Struct, const TArray<FString>& PropertyPaths, TArray<FText*>& OutTextsToSave, TArray<const FString*>* OutTextPropertyPaths = nullptr);
+
 private:
+	/** Prepare the data shared by all the rows of a generation **/
+	static void InitGenerationContext(FStringTableGenerationContext& Context);
+
+	/** Generate the entries for the texts of a loaded asset, returns true if the asset was modified **/
+	static bool GenerateEntriesForAsset(UObject* Asset, FStringTableGenerationContext& Context);
+
+	/** Generate the entries for the texts of every row of a DataTable, returns true if the DataTable was modified **/
+	static bool GenerateEntriesForDataTable(UDataTable* DataTable, const TArray<FString>& PropertyPaths, FStringTableGenerationContext& Context);
+
+	/** Generate the entries for the texts of a single row or object, returns true if any text was linked to the string table
+	*	@Container: The address of the row or object
+	*	@Struct: The struct or class of the Container
+	*	@RowName: The name used to create the new keys
+	**/
+	static bool GenerateEntriesForContainer(void* Container, const UStruct* Struct, const FString& RowName, const TArray<FString>& PropertyPaths, FStringTableGenerationContext& Context);
+
+	/** Record every localizable text of a row or object for the gather manifest, texts linked to other string tables are left out **/
+	static void AddManifestTexts(void* Container, const UStruct* Struct, const FString& RowName, FStringTableGenerationContext& Context);
+
+	/** Write the texts recorded during the generation to the gather manifest of the string table, returns true if the manifest was updated
+	*	@UnsavedPackageNames: Packages that weren't saved or failed to save, their assets keep their previous records and the manifest isn't written at all if the string table is one of them
+	**/
+	static bool WriteGatherManifest(FStringTableGenerationContext& Context, const TSet<FString>& UnsavedPackageNames);
+
+	/** Create or update the baked lookup stored next to the given string table **/
+	static UStringTableLookup* UpdateLookupTable(UStringTable* StringTable);
+
+	/** Check out the given packages (or make their files writable) and save them with asynchronous file writes
+	*	Returns true if every package was saved, the packages that failed are logged and added to OutFailedPackages
+	**/
+	static bool SaveModifiedPackages(const TArray<UPackage*>& Packages, TArray<UPackage*>& OutFailedPackages);
+
+	/** Complete the metrics of the generation and append them to the generation history **/
+	static void RecordGenerationMetrics(FStringTableGenerationContext& Context, double StartTime);
+
+	/** Returns all the text property paths of the given struct or class, cached for the whole generation **/
+	static const TArray<FString>& GetTextPropertyPaths(const UStruct* Struct, FStringTableGenerationContext& Context);
+
+	/** Returns the property paths to save for the given struct or class according to the settings **/
+	static TArray<FString> GetPropertyPathsToSave(const UStruct* Struct, FStringTableGenerationContext& Context);
+
 	/** Returns the Text Property corresponding to the given chain path **/
-	static FTextProperty* GetPropertyFromPropertyPath(const UScriptStruct* BaseStruct, FString& ChainPath);
+	static FTextProperty* GetPropertyFromPropertyPath(const UStruct* BaseStruct, FString& ChainPath);
 
-	/** Create a new string table with the given name **/
-	static UStringTable* CreateStringTable(FString& TableName);
+	/** Create or load the string table the settings point to **/
+	static UStringTable* ResolveStringTable(UStringTableGenerationSettings* Settings);
 
-	/** Returns the list of properties that need to be saved for the given row **/
-	static void GetPropertiesToSave(FTableRowBase* DataTableRow, const UScriptStruct* DtStruct, TArray<FString> PropertyPaths, TArray<FText*>& OutTextsToSave);
+	/** Create a new string table with the given name in the given folder **/
+	static UStringTable* CreateStringTable(const FString& TableName, const FString& Folder);
 
 	/** Return the list of FText matching the propertypath **/
-	static TArray<FText*> GetPropertyValuesFromPropertyPath(FTableRowBase* DataTableRow, const UScriptStruct* DtStruct, FString PropertyPath);
+	static TArray<FText*> GetPropertyValuesFromPropertyPath(void* Container, const UStruct* Struct, FString PropertyPath);
 
 	/** Returns the list of the variable addresses that correspond to the property path given into the given object 
 	*	@StartingObjects: The address of the object we want to look into
-	*	@DataStruct: The reference to the structure of the Starting object
+	*	@DataStruct: The reference to the structure or class of the Starting object
 	*	@PropertyPath: The Path to the Property we are looking for
 	**/
-	static void GetPropertyAddresses(void* StartingObjects, const UScriptStruct* DataStruct, FString PropertyPath, TMap<void*, FTextProperty*>& OutAddresses);
+	static void GetPropertyAddresses(void* StartingObjects, const UStruct* DataStruct, FString PropertyPath, TMap<void*, FTextProperty*>& OutAddresses);
+
+	/** Add the addresses of the texts found in a container item (array, map value, set element or optional value) to the given addresses **/
+	static void GetContainerItemAddresses(void* ItemAddress, FProperty* ItemProperty, const FString& RemainingPropertyPath, TMap<void*, FTextProperty*>& OutAddresses);
+
+	/** Returns the string table registered with the given id, loading its asset the first time it's requested during the generation **/
+	static FStringTableConstPtr FindSourceStringTable(FName TableId, FStringTableGenerationContext& Context);
+
+	/** Copy the entry of an already localized text, with its source string and meta-data, from its string table into the generated one
+	*	Returns true if the generated string table changed
+	**/
+	static bool CopyStringTableEntry(FName SourceTableId, const FString& Key, const FText& Text, FStringTableGenerationContext& Context);
 
 	/** Loop through all the data of the string table and return the key of the string matching the given value or nullptr if not found **/
 	static FString FindValueInStringTable(UStringTable* Table, const FString& Value);
 
-	/** Create a unique key based on the DataTable row name, property name, prefix and suffix **/
-	static FString CreateNewKeyName(const FString& RowName, UStringTable* DstStringtable, UStringTableGenerationSettings* Settings);
+	/** Returns the canonical form of a source string used by the normalized dedup (unified line endings, no trailing whitespace) **/
+	static FString NormalizeSourceString(const FString& Value);
+
+	/** Fill the normalized source string -> key index with the content of the given string table **/
+	static void BuildNormalizedSourceStringIndex(UStringTable* Table, TMap<FString, FString>& OutIndex);
+
+	/** Look for a key whose normalized source string matches the given value, confirming the hit against the string table
+	*	A stale hit (entry overwritten since it was indexed) falls back to a scan of the whole table and repairs the index
+	**/
+	static FString FindNormalizedValueInStringTable(UStringTable* Table, TMap<FString, FString>& NormalizedIndex, const FString& NormalizedValue);
 
-	/** Open or Reopen the editor for the given string table to refresh it's content after the generation **/
-	static void RefreshStringTableEditor(UStringTable* StringTable);
+	/** Create a unique key based on the DataTable row name, property name, prefix and suffix, returns an empty string if it can't be named
+	*	@KeyPropertyName: The property path whose last part names the key
+	*	@OutCollisionCount: Incremented for each generated name that was already used
+	**/
+	static FString CreateNewKeyName(const FString& RowName, const FString& KeyPropertyName, UStringTable* DstStringtable, UStringTableGenerationSettings* Settings, int32& OutCollisionCount);
+
+	/** Open the editor for the given string table after the generation, an opened editor is only rebuilt when entries were added **/
+	static void RefreshStringTableEditor(UStringTable* StringTable, bool bStringTableModified);
 };
 
 /*
@@ -66,6 +157,10 @@ public:
 	/** The DataTable used to generate the String Table **/
 	UDataTable* SourceDataTable;
 
+	/** The saved profile the settings were loaded from, keeps the resolved state between runs **/
+	UPROPERTY(EditAnywhere)
+	TObjectPtr<UStringTableGenerationProfile> Profile;
+
 	/** Should we save all the text properties or only PropertyName **/
 	UPROPERTY(EditAnywhere)
 	bool bSaveAllProperties = false;
@@ -81,6 +176,10 @@ public:
 	UPROPERTY(EditAnywhere)
 	bool bCreateNewStringTable = false;
 
+	/** The folder in which the new string table is created, visible only if bCreateNewStringTable is true **/
+	UPROPERTY(EditAnywhere, meta = (ContentDir))
+	FString StringTableFolder = TEXT("/Game/CrisisUnit/StringTables");
+
 	/** The name of the new string table, visible only if bCreateNewStringTable is true **/
 	UPROPERTY(EditAnywhere)
 	FString NewStringTableName;
@@ -100,4 +199,24 @@ public:
 	/** Should copy the string table keys of the texts that are already localized into the current string table **/
 	UPROPERTY(EditAnywhere)
 	bool bCopyAlreadyLocalizedKeys;
+
+	/** Should texts that only differ by line endings or trailing whitespace share the same string table entry **/
+	UPROPERTY(EditAnywhere)
+	bool bDedupNormalizedTexts = false;
+
+	/** Should the DataTable and the string table be saved at the end of the generation **/
+	UPROPERTY(EditAnywhere)
+	bool bSaveModifiedPackages = false;
+
+	/** Should a baked lookup (StringTableLookup asset) be kept next to the string table for fast runtime lookups **/
+	UPROPERTY(EditAnywhere)
+	bool bBakeLookupTable = false;
+
+	/** Should the texts of the processed assets be written to the gather manifest of the string table, the modified packages are then always saved **/
+	UPROPERTY(EditAnywhere)
+	bool bWriteGatherManifest = false;
+
+	/** Number of assets loaded, processed and saved together when generating from the Asset Registry **/
+	UPROPERTY(EditAnywhere)
+	int32 AssetBatchSize = 64;
 };
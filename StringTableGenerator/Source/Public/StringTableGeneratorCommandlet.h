@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "StringTableGeneratorCommandlet.generated.h"
+
+/**
+ * Commandlet to generate string table entries from the assets matching Asset Registry filters
+ * 
+ * Usage: -run=StringTableGenerator -Paths=/Game/Data+/Game/UI [-Classes=/Script/Engine.PrimaryDataAsset] [-Profile=/Game/Profiles/GP_Data.GP_Data]
+ *		(-StringTable=/Game/StringTables/ST_Data.ST_Data | -NewStringTable=ST_Data [-Folder=/Game/StringTables]) [-Prefix=Data] [-Suffix=]
+ *		[-Property=Name] [-CopyLocalizedKeys] [-DedupNormalizedTexts] [-BakeLookupTable] [-WriteGatherManifest] [-BatchSize=64]
+ * 
+ * The arguments override the configuration of the profile. Without profile, every text property is saved when -Property isn't given
+ */
+UCLASS()
+class UStringTableGeneratorCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStringTableGeneratorCommandlet();
+
+	/** UCommandlet implementation */
+	virtual int32 Main(const FString& Params) override;
+};
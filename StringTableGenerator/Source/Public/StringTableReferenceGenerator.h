@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UStringTable;
+class UStringTableGenerationSettings;
+class UStruct;
+
+/**
+ * Frozen copy of the DataTable generation of UStringTableGenerator, used as the reference the optimized generation is checked against
+ * 
+ * The translations are keyed on the generated keys, so the optimized generation has to produce exactly the same entries and links
+ * Don't optimize or fix this code: any change here changes the reference of the equivalence checks (see UStringTableEquivalenceCommandlet)
+ * It only uses the reflection to reach the texts, the compiled text visitors are not used
+ * 
+ * Intended changes of the generation made after this copy was frozen, the equivalence commandlet accounts for them instead of this code:
+ * - New keys are named after the first text property when no property is selected. This copy needs a PropertyName, so the commandlet fills it
+ * - Copied entries are indexed by the normalized dedup, and stale index hits fall back to a scan of the table. The keys can differ when
+ *   -CopyLocalizedKeys and -DedupNormalizedTexts are used together, these differences are logged as expected
+ */
+class STRINGTABLEGENERATOR_API FStringTableReferenceGenerator
+{
+public:
+	/** Generate the entries of the settings DataTable into the given string table and link its texts, like UStringTableGenerator::GenerateStringTableEntries **/
+	static void GenerateStringTableEntries(UStringTable* StringTable, UStringTableGenerationSettings* Settings);
+
+	/** List the texts of a row or object at the given property paths with the reflection, in the order this generation processes them **/
+	static void GetTexts(void* Container, const UStruct* Struct, const TArray<FString>& PropertyPaths, TArray<FText*>& OutTexts);
+};
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Writes the compiled text visitors (TStringTableTextVisitor specializations) of native row structs
+ * The written header has to be included in a single .cpp of an editor module of the project, it registers its visitors itself
+ */
+class STRINGTABLEGENERATOR_API FStringTableTextVisitorCodeGenerator
+{
+public:
+	/** Returns the code of the visitors of the given native structs **/
+	static FString GenerateCode(const TArray<const UScriptStruct*>& Structs);
+
+	/** Write the code of the visitors of the given native structs into the given file **/
+	static bool WriteFile(const TArray<const UScriptStruct*>& Structs, const FString& FilePath);
+
+private:
+	/** Append the code of the visitor of a single struct, returns false if none of its texts can be reached from C++ **/
+	static bool AppendStructVisitor(const UScriptStruct* Struct, FString& OutCode);
+
+	/** Append the code adding the texts of the property path to the output array
+	*	@Struct: The struct or class of the Access expression
+	*	@Access: The C++ expression of the object we are looking into
+	*	@PathParts: The remaining property names of the path
+	*	@Depth: The container nesting level, used to name the loop variables
+	**/
+	static bool AppendPropertyPathVisit(const UStruct* Struct, const FString& Access, TArrayView<const FString> PathParts, int32 Depth, const FString& Indent, FString& OutCode);
+
+	/** Returns the path to include the header declaring the given struct **/
+	static FString GetIncludePath(const UScriptStruct* Struct);
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "StringTableTextVisitorCommandlet.generated.h"
+
+class UDataTable;
+
+/**
+ * Commandlet to write the compiled text visitors of native row structs, or to compare them to the reflection
+ * 
+ * Usage: -run=StringTableTextVisitor -Structs=/Script/MyGame.MyRow+/Script/MyGame.MyOtherRow -Output=Source/MyGameEditor/Private/MyGameTextVisitors.h
+ *		  -run=StringTableTextVisitor -Benchmark -DataTable=/Game/Data/DT_MyRows.DT_MyRows [-Iterations=100]
+ */
+UCLASS()
+class UStringTableTextVisitorCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStringTableTextVisitorCommandlet();
+
+	/** UCommandlet implementation */
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Collect the texts of every row with the compiled visitors then with the reflection, check that both find the same texts and log the timings **/
+	int32 RunBenchmark(UDataTable* DataTable, int32 Iterations);
+};
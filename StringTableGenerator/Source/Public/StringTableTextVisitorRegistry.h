@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/DelayedAutoRegister.h"
+
+/** Function reaching directly the non empty texts of a single property path of a native struct **/
+typedef void (*FStringTableTextVisitorFunc)(void* Container, TArray<FText*>& OutTexts);
+
+/**
+ * Compiled visitor of the texts of a native row struct, specialized by the code written by FStringTableTextVisitorCodeGenerator
+ */
+template<typename RowType>
+struct TStringTableTextVisitor;
+
+namespace StringTableTextVisitor
+{
+	/** Add the text to the output if it isn't empty, same filter as the reflection based traversal **/
+	FORCEINLINE void AddText(FText& Text, TArray<FText*>& OutTexts)
+	{
+		if (!Text.IsEmpty())
+		{
+			OutTexts.Add(&Text);
+		}
+	}
+}
+
+/**
+ * Registry of the compiled text visitors, the text collection uses them instead of the reflection when one exists for a struct
+ */
+class STRINGTABLEGENERATOR_API FStringTableTextVisitorRegistry
+{
+public:
+	static FStringTableTextVisitorRegistry& Get();
+
+	/** Register the visitor to use for a property path of the given struct **/
+	void Register(const UStruct* Struct, const FString& PropertyPath, FStringTableTextVisitorFunc Visitor);
+
+	/** Register the generated visitors of a native struct **/
+	template<typename RowType>
+	void Register()
+	{
+		TStringTableTextVisitor<RowType>::Register(*this);
+	}
+
+	/** Returns the visitor registered for the property path of the given struct or nullptr, always nullptr while the registry is disabled **/
+	FStringTableTextVisitorFunc Find(const UStruct* Struct, const FString& PropertyPath) const;
+
+	/** Does the given struct have any registered visitor **/
+	bool HasVisitors(const UStruct* Struct) const;
+
+	/** Enable or disable the compiled visitors, used to compare them to the reflection **/
+	void SetEnabled(bool bInEnabled);
+
+private:
+	/** The visitors of each property path of each native struct **/
+	TMap<const UStruct*, TMap<FString, FStringTableTextVisitorFunc>> Visitors;
+
+	/** Are the visitors used **/
+	bool bEnabled = true;
+};
+
+/** Register the generated visitor of a native row struct once the object system is ready, placed by the generated code **/
+#define REGISTER_STRINGTABLE_TEXT_VISITOR(RowType) \
+	static FDelayedAutoRegisterHelper PREPROCESSOR_JOIN(GRegisterStringTableTextVisitor_, RowType)(EDelayedRegisterRunPhase::ObjectSystemReady, []() \
+	{ \
+		FStringTableTextVisitorRegistry::Get().Register<RowType>(); \
+	});
@@ -42,6 +42,12 @@ public class StringTableGenerator : ModuleRules
 				"UnrealEd",
 				"PropertyEditor",
 				"StringTableEditor",
+				"AssetRegistry",
+				"Json",
+				"JsonUtilities",
+				"Localization",
+				"SourceControl",
+				"StringTableGeneratorRuntime",
                 "ToolMenus",
             }
 			);
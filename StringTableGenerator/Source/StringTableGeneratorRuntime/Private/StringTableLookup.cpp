@@ -0,0 +1,194 @@
+#include "StringTableLookup.h"
+#include "Hash/CityHash.h"
+#include "Internationalization/StringTable.h"
+#include "Internationalization/StringTableCore.h"
+
+bool UStringTableLookup::FindSourceString(FUtf8StringView Key, FUtf8StringView& OutSourceString) const
+{
+	if (Slots.IsEmpty())
+	{
+		return false;
+	}
+
+	//The bucket gives the seed that sends the key to its own slot
+	const uint64 KeyHash = HashKey(Key);
+	const uint32 Seed = BucketSeeds[KeyHash % BucketSeeds.Num()];
+	const FStringTableLookupSlot& Slot = Slots[MixHash(KeyHash, Seed) % Slots.Num()];
+
+	//Unknown keys land in the slot of another key, compare them to be sure
+	const UTF8CHAR* SlotData = reinterpret_cast<const UTF8CHAR*>(Blob.GetData() + Slot.KeyOffset);
+	if (!FUtf8StringView(SlotData, Slot.KeyLength).Equals(Key, ESearchCase::CaseSensitive))
+	{
+		return false;
+	}
+
+	OutSourceString = FUtf8StringView(SlotData + Slot.KeyLength, Slot.SourceStringLength);
+	return true;
+}
+
+bool UStringTableLookup::FindSourceString(FStringView Key, FUtf8StringView& OutSourceString) const
+{
+	const auto Utf8Key = StringCast<UTF8CHAR>(Key.GetData(), Key.Len());
+	return FindSourceString(FUtf8StringView(Utf8Key.Get(), Utf8Key.Length()), OutSourceString);
+}
+
+int32 UStringTableLookup::Num() const
+{
+	return Slots.Num();
+}
+
+uint64 UStringTableLookup::HashKey(FUtf8StringView Key)
+{
+	return CityHash64(reinterpret_cast<const char*>(Key.GetData()), Key.Len());
+}
+
+uint64 UStringTableLookup::MixHash(uint64 KeyHash, uint32 Seed)
+{
+	uint64 Value = KeyHash + Seed * 0x9E3779B97F4A7C15ull;
+	Value = (Value ^ (Value >> 33)) * 0xFF51AFD7ED558CCDull;
+	Value = (Value ^ (Value >> 33)) * 0xC4CEB9FE1A85EC53ull;
+	return Value ^ (Value >> 33);
+}
+
+SIZE_T UStringTableLookup::GetAllocatedSize() const
+{
+	return BucketSeeds.GetAllocatedSize() + Slots.GetAllocatedSize() + Blob.GetAllocatedSize();
+}
+
+bool UStringTableLookup::Build(TArray<TPair<FString, FString>> Entries)
+{
+	BucketSeeds.Reset();
+	Slots.Reset();
+	Blob.Reset();
+
+	//Sort the entries by key so the baked data doesn't depend on the order of the string table
+	Entries.Sort([](const TPair<FString, FString>& A, const TPair<FString, FString>& B)
+	{
+		return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+	});
+
+	//Pack the keys and source strings into the blob
+	const int32 NumEntries = Entries.Num();
+	TArray<FStringTableLookupSlot> PackedEntries;
+	TArray<uint64> KeyHashes;
+	PackedEntries.Reserve(NumEntries);
+	KeyHashes.Reserve(NumEntries);
+	for (const TPair<FString, FString>& Entry : Entries)
+	{
+		const auto Utf8Key = StringCast<UTF8CHAR>(*Entry.Key, Entry.Key.Len());
+		const auto Utf8SourceString = StringCast<UTF8CHAR>(*Entry.Value, Entry.Value.Len());
+
+		FStringTableLookupSlot& PackedEntry = PackedEntries.AddDefaulted_GetRef();
+		PackedEntry.KeyOffset = Blob.Num();
+		PackedEntry.KeyLength = Utf8Key.Length();
+		PackedEntry.SourceStringLength = Utf8SourceString.Length();
+
+		Blob.Append(reinterpret_cast<const uint8*>(Utf8Key.Get()), Utf8Key.Length());
+		Blob.Append(reinterpret_cast<const uint8*>(Utf8SourceString.Get()), Utf8SourceString.Length());
+		KeyHashes.Add(HashKey(FUtf8StringView(Utf8Key.Get(), Utf8Key.Length())));
+	}
+
+	if (NumEntries == 0)
+	{
+		return true;
+	}
+
+	//Group the keys by bucket, about 4 keys per bucket keeps the seed search short
+	const int32 NumBuckets = FMath::Max(1, (NumEntries + 3) / 4);
+	TArray<TArray<int32>> Buckets;
+	Buckets.SetNum(NumBuckets);
+	for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+	{
+		Buckets[KeyHashes[EntryIndex] % NumBuckets].Add(EntryIndex);
+	}
+
+	//Place the biggest buckets first, while most of the slots are still free
+	TArray<int32> BucketOrder;
+	for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+	{
+		BucketOrder.Add(BucketIndex);
+	}
+
+	BucketOrder.StableSort([&Buckets](int32 A, int32 B)
+	{
+		return Buckets[A].Num() > Buckets[B].Num();
+	});
+
+	//Find for each bucket the first seed sending all its keys to free and distinct slots
+	//A single key needs about NumEntries tries for the last free slot, giving up way above means two keys have the same hash
+	const uint32 MaxSeed = (uint32)FMath::Min<uint64>(MAX_uint32, FMath::Max<uint64>(1 << 16, (uint64)NumEntries * 64));
+	BucketSeeds.SetNumZeroed(NumBuckets);
+	Slots.SetNum(NumEntries);
+	TBitArray<> UsedSlots(false, NumEntries);
+	TArray<int32, TInlineAllocator<16>> BucketSlots;
+	for (int32 BucketIndex : BucketOrder)
+	{
+		const TArray<int32>& Bucket = Buckets[BucketIndex];
+		if (Bucket.IsEmpty())
+		{
+			break;
+		}
+
+		bool bPlaced = false;
+		for (uint32 Seed = 0; Seed < MaxSeed && !bPlaced; ++Seed)
+		{
+			BucketSlots.Reset();
+			bPlaced = true;
+			for (int32 EntryIndex : Bucket)
+			{
+				const int32 Slot = MixHash(KeyHashes[EntryIndex], Seed) % NumEntries;
+				if (UsedSlots[Slot] || BucketSlots.Contains(Slot))
+				{
+					bPlaced = false;
+					break;
+				}
+
+				BucketSlots.Add(Slot);
+			}
+
+			if (bPlaced)
+			{
+				BucketSeeds[BucketIndex] = Seed;
+			}
+		}
+
+		if (!bPlaced)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to build the lookup %s, two keys have the same hash"), *GetPathName());
+			BucketSeeds.Reset();
+			Slots.Reset();
+			Blob.Reset();
+			return false;
+		}
+
+		for (int32 i = 0; i < Bucket.Num(); ++i)
+		{
+			UsedSlots[BucketSlots[i]] = true;
+			Slots[BucketSlots[i]] = PackedEntries[Bucket[i]];
+		}
+	}
+
+	return true;
+}
+
+#if WITH_EDITOR
+void UStringTableLookup::Rebuild()
+{
+	UStringTable* StringTable = SourceStringTable.LoadSynchronous();
+	if (StringTable == nullptr)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s has no source string table, the lookup is empty"), *GetPathName());
+		Build({});
+		return;
+	}
+
+	TArray<TPair<FString, FString>> Entries;
+	StringTable->GetStringTable()->EnumerateSourceStrings([&Entries](const FString& InKey, const FString& InSourceString)
+	{
+		Entries.Emplace(InKey, InSourceString);
+		return true; // continue enumeration
+	});
+
+	Build(MoveTemp(Entries));
+}
+#endif
@@ -0,0 +1,183 @@
+#include "StringTableLookup.h"
+#include "Internationalization/StringTableCore.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace StringTableLookupTests
+{
+	static constexpr EAutomationTestFlags TestFlags = EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter;
+
+	/** Find a key in the lookup and convert the source string back for the comparisons **/
+	static bool FindSourceString(const UStringTableLookup* Lookup, const FString& Key, FString& OutSourceString)
+	{
+		FUtf8StringView SourceString;
+		if (!Lookup->FindSourceString(FStringView(Key), SourceString))
+		{
+			return false;
+		}
+
+		OutSourceString = FString(SourceString);
+		return true;
+	}
+
+	/** Fill a string table with keys named like the generated ones, a few of them with non-ASCII or empty source strings **/
+	static FStringTableRef CreateStringTable(int32 NumEntries)
+	{
+		FStringTableRef StringTable = FStringTable::NewStringTable();
+		for (int32 EntryIndex = 0; EntryIndex < NumEntries; ++EntryIndex)
+		{
+			FString SourceString;
+			switch (EntryIndex % 4)
+			{
+			case 0: SourceString = FString::Printf(TEXT("Item name %d"), EntryIndex); break;
+			case 1: SourceString = FString::Printf(TEXT("\u00C9p\u00E9e \u00E0 deux mains n\u00B0%d"), EntryIndex); break;
+			case 2: SourceString = FString::Printf(TEXT("Line one\r\nLine two %d"), EntryIndex); break;
+			default: break;
+			}
+
+			StringTable->SetSourceString(FString::Printf(TEXT("Data_Row%d_Name"), EntryIndex), SourceString);
+		}
+
+		return StringTable;
+	}
+
+	/** Build a lookup from the entries of a string table, like UStringTableLookup::Rebuild does **/
+	static UStringTableLookup* CreateLookup(const FStringTableConstRef& StringTable)
+	{
+		TArray<TPair<FString, FString>> Entries;
+		StringTable->EnumerateSourceStrings([&Entries](const FString& InKey, const FString& InSourceString)
+		{
+			Entries.Emplace(InKey, InSourceString);
+			return true; // continue enumeration
+		});
+
+		UStringTableLookup* Lookup = NewObject<UStringTableLookup>(GetTransientPackage());
+		Lookup->Build(MoveTemp(Entries));
+		return Lookup;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStringTableLookupEmptyTest, "StringTableGenerator.Lookup.Empty", StringTableLookupTests::TestFlags)
+
+bool FStringTableLookupEmptyTest::RunTest(const FString& Parameters)
+{
+	UStringTableLookup* Lookup = NewObject<UStringTableLookup>(GetTransientPackage());
+	TestTrue(TEXT("An empty table is built"), Lookup->Build({}));
+	TestEqual(TEXT("Entry count"), Lookup->Num(), 0);
+
+	FString SourceString;
+	TestFalse(TEXT("Any key is unknown"), StringTableLookupTests::FindSourceString(Lookup, TEXT("Key"), SourceString));
+	TestFalse(TEXT("The empty key is unknown"), StringTableLookupTests::FindSourceString(Lookup, TEXT(""), SourceString));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStringTableLookupSingleKeyTest, "StringTableGenerator.Lookup.SingleKey", StringTableLookupTests::TestFlags)
+
+bool FStringTableLookupSingleKeyTest::RunTest(const FString& Parameters)
+{
+	UStringTableLookup* Lookup = NewObject<UStringTableLookup>(GetTransientPackage());
+	TestTrue(TEXT("A single key is built"), Lookup->Build({ { TEXT("Data_Sword_Name"), TEXT("\u00C9p\u00E9e") } }));
+	TestEqual(TEXT("Entry count"), Lookup->Num(), 1);
+
+	FString SourceString;
+	TestTrue(TEXT("The key is found"), StringTableLookupTests::FindSourceString(Lookup, TEXT("Data_Sword_Name"), SourceString));
+	TestEqual(TEXT("Source string"), SourceString, FString(TEXT("\u00C9p\u00E9e")));
+
+	//Every key lands in the only slot, only the comparison rejects the other ones
+	TestFalse(TEXT("Other keys are unknown"), StringTableLookupTests::FindSourceString(Lookup, TEXT("Data_Shield_Name"), SourceString));
+	TestFalse(TEXT("Keys are case sensitive"), StringTableLookupTests::FindSourceString(Lookup, TEXT("data_sword_name"), SourceString));
+	TestFalse(TEXT("Prefixes of the key are unknown"), StringTableLookupTests::FindSourceString(Lookup, TEXT("Data_Sword"), SourceString));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStringTableLookupUnknownKeysTest, "StringTableGenerator.Lookup.UnknownKeys", StringTableLookupTests::TestFlags)
+
+bool FStringTableLookupUnknownKeysTest::RunTest(const FString& Parameters)
+{
+	FStringTableRef StringTable = StringTableLookupTests::CreateStringTable(1000);
+	UStringTableLookup* Lookup = StringTableLookupTests::CreateLookup(StringTable);
+
+	//Each unknown key lands in the slot of a known one
+	int32 FoundCount = 0;
+	for (int32 KeyIndex = 0; KeyIndex < 10000; ++KeyIndex)
+	{
+		FString SourceString;
+		FoundCount += StringTableLookupTests::FindSourceString(Lookup, FString::Printf(TEXT("Data_Row%d_Name"), 1000 + KeyIndex), SourceString) ? 1 : 0;
+		FoundCount += StringTableLookupTests::FindSourceString(Lookup, FString::Printf(TEXT("Data_Row%d_Nam"), KeyIndex % 1000), SourceString) ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Unknown keys found"), FoundCount, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FStringTableLookupMatchesStringTableTest, "StringTableGenerator.Lookup.MatchesStringTable", StringTableLookupTests::TestFlags)
+
+bool FStringTableLookupMatchesStringTableTest::RunTest(const FString& Parameters)
+{
+	const int32 NumEntries = 10000;
+	FStringTableRef StringTable = StringTableLookupTests::CreateStringTable(NumEntries);
+	UStringTableLookup* Lookup = StringTableLookupTests::CreateLookup(StringTable);
+	TestEqual(TEXT("Entry count"), Lookup->Num(), NumEntries);
+
+	//The strings of the string table alone, its maps and entries come on top of it
+	TArray<FString> Keys;
+	SIZE_T StringTableStringsSize = 0;
+	StringTable->EnumerateSourceStrings([&Keys, &StringTableStringsSize](const FString& InKey, const FString& InSourceString)
+	{
+		Keys.Add(InKey);
+		StringTableStringsSize += InKey.GetAllocatedSize() + InSourceString.GetAllocatedSize();
+		return true; // continue enumeration
+	});
+
+	int32 MismatchCount = 0;
+	for (const FString& Key : Keys)
+	{
+		FString ExpectedSourceString;
+		FString SourceString;
+		if (!StringTable->GetSourceString(Key, ExpectedSourceString)
+			|| !StringTableLookupTests::FindSourceString(Lookup, Key, SourceString)
+			|| !SourceString.Equals(ExpectedSourceString, ESearchCase::CaseSensitive))
+		{
+			if (MismatchCount++ < 10)
+			{
+				AddError(FString::Printf(TEXT("%s: \"%s\" instead of \"%s\""), *Key, *SourceString, *ExpectedSourceString));
+			}
+		}
+	}
+	TestEqual(TEXT("Keys with a different source string"), MismatchCount, 0);
+
+	//Time the same lookups both ways, the numbers are logged for comparison and not checked since they depend on the machine
+	const int32 Passes = 10;
+	int32 FoundCount = 0;
+
+	const double StringTableStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < Passes; ++Pass)
+	{
+		for (const FString& Key : Keys)
+		{
+			FString SourceString;
+			FoundCount += StringTable->GetSourceString(Key, SourceString) ? 1 : 0;
+		}
+	}
+	const double StringTableSeconds = FPlatformTime::Seconds() - StringTableStart;
+
+	const double LookupStart = FPlatformTime::Seconds();
+	for (int32 Pass = 0; Pass < Passes; ++Pass)
+	{
+		for (const FString& Key : Keys)
+		{
+			FUtf8StringView SourceString;
+			FoundCount += Lookup->FindSourceString(FStringView(Key), SourceString) ? 1 : 0;
+		}
+	}
+	const double LookupSeconds = FPlatformTime::Seconds() - LookupStart;
+	TestEqual(TEXT("Keys found by both"), FoundCount, Keys.Num() * Passes * 2);
+
+	AddInfo(FString::Printf(TEXT("%d lookups: FStringTable::GetSourceString %.3f ms, UStringTableLookup::FindSourceString %.3f ms"), Keys.Num() * Passes, StringTableSeconds * 1000.0, LookupSeconds * 1000.0));
+	AddInfo(FString::Printf(TEXT("%d entries: baked lookup %llu bytes, string table keys and source strings alone %llu bytes"), NumEntries, (uint64)Lookup->GetAllocatedSize(), (uint64)StringTableStringsSize));
+	return true;
+}
+
+#endif
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+
+#include "StringTableLookup.generated.h"
+
+class UStringTable;
+
+/**
+ * Location of an entry in the packed blob of a string table lookup
+ */
+USTRUCT()
+struct FStringTableLookupSlot
+{
+	GENERATED_BODY()
+
+	/** Offset of the key in the blob, the source string follows the key **/
+	UPROPERTY()
+	uint32 KeyOffset = 0;
+
+	/** Length of the key in UTF-8 code units **/
+	UPROPERTY()
+	uint32 KeyLength = 0;
+
+	/** Length of the source string in UTF-8 code units **/
+	UPROPERTY()
+	uint32 SourceStringLength = 0;
+};
+
+/**
+ * Baked lookup of the entries of a string table: a minimal perfect hash over the keys and a packed UTF-8 blob of the keys and source strings
+ * Baked by the string table generation when its string table changes, lookups don't allocate
+ */
+UCLASS(BlueprintType)
+class STRINGTABLEGENERATORRUNTIME_API UStringTableLookup : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Find the source string of the given key, the returned view points into the lookup and stays valid as long as it is loaded **/
+	bool FindSourceString(FUtf8StringView Key, FUtf8StringView& OutSourceString) const;
+
+	/** Find the source string of the given key, keys up to 128 characters are converted without allocating **/
+	bool FindSourceString(FStringView Key, FUtf8StringView& OutSourceString) const;
+
+	/** Number of entries in the lookup **/
+	int32 Num() const;
+
+	/** Memory used by the baked data of the lookup **/
+	SIZE_T GetAllocatedSize() const;
+
+	/** Build the lookup from the given keys and source strings, returns false if two keys have the same hash and the lookup is left empty **/
+	bool Build(TArray<TPair<FString, FString>> Entries);
+
+#if WITH_EDITOR
+	/** Rebuild the lookup from the content of the source string table **/
+	void Rebuild();
+#endif
+
+	/** The string table this lookup is built from **/
+	UPROPERTY(EditAnywhere, Category = "Lookup")
+	TSoftObjectPtr<UStringTable> SourceStringTable;
+
+private:
+	/** Hash of a key, used to find its bucket **/
+	static uint64 HashKey(FUtf8StringView Key);
+
+	/** Mix the hash of a key with the seed of its bucket to find its slot **/
+	static uint64 MixHash(uint64 KeyHash, uint32 Seed);
+
+	/** Seed of each bucket, chosen so every key of the table lands in its own slot **/
+	UPROPERTY()
+	TArray<uint32> BucketSeeds;
+
+	/** One slot per entry **/
+	UPROPERTY()
+	TArray<FStringTableLookupSlot> Slots;
+
+	/** The keys and source strings of all the entries **/
+	UPROPERTY()
+	TArray<uint8> Blob;
+};